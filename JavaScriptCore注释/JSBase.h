@@ -33,14 +33,42 @@ typedef struct OpaqueJSString* JSStringRef;
 JSClassRef一个JavaScript类。与JSObjectMake一起用于构造具有自定义行为的对象。  */
 typedef struct OpaqueJSClass* JSClassRef;
 
+/*! @typedef JSObjectTemplateRef A precomputed object shape. Used with JSObjectMakeWithTemplate to construct objects whose properties are known up front. */
+/* 预先计算好的对象形状。与JSObjectMakeWithTemplate一起用于构造属性事先已知的对象。 */
+typedef struct OpaqueJSObjectTemplate* JSObjectTemplateRef;
+
+/*! @typedef JSPreparedCallRef A validated callee, 'this' object and argument frame, used to call the same JavaScript function repeatedly. */
+/* 一个已验证的被调用函数、this对象和参数帧，用于重复调用同一个JavaScript函数。 */
+typedef struct OpaqueJSPreparedCall* JSPreparedCallRef;
+
 /*! @typedef JSPropertyNameArrayRef An array of JavaScript property names. */
 /* JSPropertyNameArrayRef一个JavaScript属性名数组 */
 typedef struct OpaqueJSPropertyNameArray* JSPropertyNameArrayRef;
 
+/*! @typedef JSPropertyKeyRef A prepared JavaScript property name. Looking up a property through a JSPropertyKey skips re-hashing and re-interning its name on every access. */
+/* 预处理过的JavaScript属性名。通过JSPropertyKey访问属性时，无需每次都重新计算哈希和驻留名称。 */
+typedef struct OpaqueJSPropertyKey* JSPropertyKeyRef;
+
+/*! @typedef JSPropertyIteratorRef A cursor over the names of a JavaScript object's properties. */
+/* 遍历JavaScript对象属性名的游标。 */
+typedef struct OpaqueJSPropertyIterator* JSPropertyIteratorRef;
+
 /*! @typedef JSPropertyNameAccumulatorRef An ordered set used to collect the names of a JavaScript object's properties. */
 /*  用于收集JavaScript对象属性名称的有序集合。 */
 typedef struct OpaqueJSPropertyNameAccumulator* JSPropertyNameAccumulatorRef;
 
+/*! @typedef JSRegExpRef A compiled regular expression that can be matched against strings from C without creating JavaScript objects. */
+/* 编译好的正则表达式，可以在C中直接匹配字符串而不创建JavaScript对象。 */
+typedef struct OpaqueJSRegExp* JSRegExpRef;
+
+/*! @typedef JSSerializedValueRef A JavaScript value graph serialized with the structured clone algorithm. Not tied to any context group, so it can be deserialized in a different one. */
+/* 使用结构化克隆算法序列化的JavaScript值图。不属于任何上下文组，因此可以在另一个组中反序列化。 */
+typedef struct OpaqueJSSerializedValue* JSSerializedValueRef;
+
+/*! @typedef JSWeakRef A weak reference to a JavaScript object. Does not keep the object alive. */
+/* 对JavaScript对象的弱引用。不会阻止对象被回收。 */
+typedef struct OpaqueJSWeak* JSWeakRef;
+
 /*! @typedef JSTypedArrayBytesDeallocator A function used to deallocate bytes passed to a Typed Array constructor. The function should take two arguments. The first is a pointer to the bytes that were originally passed to the Typed Array constructor. The second is a pointer to additional information desired at the time the bytes are to be freed. */
 /*  用于释放传递给类型化数组构造函数的字节的函数。函数应该有两个参数。第一个是指向最初传递给类型化数组构造函数的字节的指针。第二个是指向释放字节时所需的附加信息的指针。  */
 typedef void (*JSTypedArrayBytesDeallocator)(void* bytes, void* deallocatorContext);
@@ -55,6 +83,10 @@ typedef const struct OpaqueJSValue* JSValueRef;
 /*  一个JavaScript对象。JSObject是JSValue。  */
 typedef struct OpaqueJSValue* JSObjectRef;
 
+/*! @typedef JSPersistentValueRef A handle that keeps a JavaScript value alive until the handle is destroyed. */
+/*  一个句柄，在句柄被销毁之前保持JavaScript值存活。  */
+typedef struct OpaqueJSPersistentValue* JSPersistentValueRef;
+
 /* Clang's __has_declspec_attribute emulation */
 /* https://clang.llvm.org/docs/LanguageExtensions.html#has-declspec-attribute */
 
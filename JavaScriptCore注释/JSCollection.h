@@ -0,0 +1,176 @@
+#ifndef JSCollection_h
+#define JSCollection_h
+
+#include <JavaScriptCore/JSBase.h>
+#include <JavaScriptCore/JSValueRef.h>
+#include <JavaScriptCore/WebKitAvailability.h>
+
+#ifndef __cplusplus
+#include <stdbool.h>
+#endif
+#include <stddef.h> /* for size_t */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ------------- Map functions -------------
+
+/*!
+ @function
+ @abstract           Creates an empty JavaScript Map object.
+ |--  创建一个空的JavaScript Map对象。
+ @param ctx          The execution context to use.
+ @param capacity     The number of entries to reserve room for. Pass 0 to use the default capacity.
+ @param exception    A pointer to a JSValueRef in which to store an exception, if any. Pass NULL if you do not care to store an exception.
+ @result             A JSObjectRef that is a Map, or NULL if there was an error.
+ @discussion         The Map's hash table is allocated large enough to hold capacity entries without rehashing.
+ */
+JS_EXPORT JSObjectRef JSObjectMakeMap(JSContextRef ctx, size_t capacity, JSValueRef* exception) API_AVAILABLE(macos(JSC_MAC_TBA), ios(JSC_IOS_TBA));
+
+/*!
+ @function
+ @abstract           Inserts or replaces entries in a JavaScript Map object.
+ @param ctx          The execution context to use.
+ @param map          The Map object to insert into.
+ @param count        An integer count of the number of keys in keys.
+ @param keys         A JSValue array of count keys.
+ @param values       A JSValue array of count values. values[i] is stored under keys[i].
+ @param exception    A pointer to a JSValueRef in which to store an exception, if any. Pass NULL if you do not care to store an exception.
+ @result             true if every entry was stored, or false if map is not a Map object.
+ @discussion         Entries are stored in order, as if by calling the built-in Map.prototype.set for each key, but directly into map's hash table: an overridden set method is not called. The table grows at most once, before the first entry is stored.
+ */
+JS_EXPORT bool JSMapPutEntries(JSContextRef ctx, JSObjectRef map, size_t count, const JSValueRef keys[], const JSValueRef values[], JSValueRef* exception) API_AVAILABLE(macos(JSC_MAC_TBA), ios(JSC_IOS_TBA));
+
+/*!
+ @function
+ @abstract           Gets the value stored under a key in a JavaScript Map object.
+ @param ctx          The execution context to use.
+ @param map          The Map object to look up.
+ @param key          The key to look up.
+ @param exception    A pointer to a JSValueRef in which to store an exception, if any. Pass NULL if you do not care to store an exception.
+ @result             The value stored under key, or NULL if map has no entry for key or is not a Map object.
+ */
+JS_EXPORT JSValueRef JSMapGet(JSContextRef ctx, JSObjectRef map, JSValueRef key, JSValueRef* exception) API_AVAILABLE(macos(JSC_MAC_TBA), ios(JSC_IOS_TBA));
+
+/*!
+ @function
+ @abstract           Gets the values stored under several keys in a JavaScript Map object.
+ @param ctx          The execution context to use.
+ @param map          The Map object to look up.
+ @param count        An integer count of the number of keys in keys.
+ @param keys         A JSValue array of count keys.
+ @param values       A JSValue array of at least count elements. On return, values[i] contains the value stored under keys[i], or NULL if map has no entry for keys[i].
+ @param exception    A pointer to a JSValueRef in which to store an exception, if any. Pass NULL if you do not care to store an exception.
+ @result             true if the lookups were performed, or false if map is not a Map object.
+ */
+JS_EXPORT bool JSMapGetValues(JSContextRef ctx, JSObjectRef map, size_t count, const JSValueRef keys[], JSValueRef values[], JSValueRef* exception) API_AVAILABLE(macos(JSC_MAC_TBA), ios(JSC_IOS_TBA));
+
+/*!
+ @function
+ @abstract           Tests whether a JavaScript Map object has an entry for a key.
+ @param ctx          The execution context to use.
+ @param map          The Map object to test.
+ @param key          The key to look up.
+ @param exception    A pointer to a JSValueRef in which to store an exception, if any. Pass NULL if you do not care to store an exception.
+ @result             true if map has an entry for key, otherwise false.
+ */
+JS_EXPORT bool JSMapHas(JSContextRef ctx, JSObjectRef map, JSValueRef key, JSValueRef* exception) API_AVAILABLE(macos(JSC_MAC_TBA), ios(JSC_IOS_TBA));
+
+/*!
+ @function
+ @abstract           Removes the entry for a key from a JavaScript Map object.
+ @param ctx          The execution context to use.
+ @param map          The Map object to remove from.
+ @param key          The key whose entry to remove.
+ @param exception    A pointer to a JSValueRef in which to store an exception, if any. Pass NULL if you do not care to store an exception.
+ @result             true if an entry was removed, otherwise false.
+ */
+JS_EXPORT bool JSMapDelete(JSContextRef ctx, JSObjectRef map, JSValueRef key, JSValueRef* exception) API_AVAILABLE(macos(JSC_MAC_TBA), ios(JSC_IOS_TBA));
+
+/*!
+ @function
+ @abstract           Returns the number of entries in a JavaScript Map object.
+ @param ctx          The execution context to use.
+ @param map          The Map object whose size to return.
+ @param exception    A pointer to a JSValueRef in which to store an exception, if any. Pass NULL if you do not care to store an exception.
+ @result             The number of entries in map, or 0 if map is not a Map object.
+ */
+JS_EXPORT size_t JSMapGetSize(JSContextRef ctx, JSObjectRef map, JSValueRef* exception) API_AVAILABLE(macos(JSC_MAC_TBA), ios(JSC_IOS_TBA));
+
+// ------------- Set functions -------------
+
+/*!
+ @function
+ @abstract           Creates an empty JavaScript Set object.
+ |--  创建一个空的JavaScript Set对象。
+ @param ctx          The execution context to use.
+ @param capacity     The number of values to reserve room for. Pass 0 to use the default capacity.
+ @param exception    A pointer to a JSValueRef in which to store an exception, if any. Pass NULL if you do not care to store an exception.
+ @result             A JSObjectRef that is a Set, or NULL if there was an error.
+ */
+JS_EXPORT JSObjectRef JSObjectMakeSet(JSContextRef ctx, size_t capacity, JSValueRef* exception) API_AVAILABLE(macos(JSC_MAC_TBA), ios(JSC_IOS_TBA));
+
+/*!
+ @function
+ @abstract           Adds values to a JavaScript Set object.
+ @param ctx          The execution context to use.
+ @param set          The Set object to add to.
+ @param count        An integer count of the number of values in values.
+ @param values       A JSValue array of count values.
+ @param exception    A pointer to a JSValueRef in which to store an exception, if any. Pass NULL if you do not care to store an exception.
+ @result             true if every value was added, or false if set is not a Set object.
+ @discussion         Values are added in order, as if by calling the built-in Set.prototype.add for each one, but directly into set's hash table: an overridden add method is not called.
+ */
+JS_EXPORT bool JSSetAddValues(JSContextRef ctx, JSObjectRef set, size_t count, const JSValueRef values[], JSValueRef* exception) API_AVAILABLE(macos(JSC_MAC_TBA), ios(JSC_IOS_TBA));
+
+/*!
+ @function
+ @abstract           Tests whether a JavaScript Set object contains a value.
+ @param ctx          The execution context to use.
+ @param set          The Set object to test.
+ @param value        The value to look up.
+ @param exception    A pointer to a JSValueRef in which to store an exception, if any. Pass NULL if you do not care to store an exception.
+ @result             true if set contains value, otherwise false.
+ */
+JS_EXPORT bool JSSetHas(JSContextRef ctx, JSObjectRef set, JSValueRef value, JSValueRef* exception) API_AVAILABLE(macos(JSC_MAC_TBA), ios(JSC_IOS_TBA));
+
+/*!
+ @function
+ @abstract           Tests whether a JavaScript Set object contains each of several values.
+ @param ctx          The execution context to use.
+ @param set          The Set object to test.
+ @param count        An integer count of the number of values in values.
+ @param values       A JSValue array of count values to look up.
+ @param results      A bool array of at least count elements. On return, results[i] is true if set contains values[i], otherwise false.
+ @param exception    A pointer to a JSValueRef in which to store an exception, if any. Pass NULL if you do not care to store an exception.
+ @result             true if the lookups were performed, or false if set is not a Set object.
+ */
+JS_EXPORT bool JSSetHasValues(JSContextRef ctx, JSObjectRef set, size_t count, const JSValueRef values[], bool results[], JSValueRef* exception) API_AVAILABLE(macos(JSC_MAC_TBA), ios(JSC_IOS_TBA));
+
+/*!
+ @function
+ @abstract           Removes a value from a JavaScript Set object.
+ @param ctx          The execution context to use.
+ @param set          The Set object to remove from.
+ @param value        The value to remove.
+ @param exception    A pointer to a JSValueRef in which to store an exception, if any. Pass NULL if you do not care to store an exception.
+ @result             true if value was removed, otherwise false.
+ */
+JS_EXPORT bool JSSetDelete(JSContextRef ctx, JSObjectRef set, JSValueRef value, JSValueRef* exception) API_AVAILABLE(macos(JSC_MAC_TBA), ios(JSC_IOS_TBA));
+
+/*!
+ @function
+ @abstract           Returns the number of values in a JavaScript Set object.
+ @param ctx          The execution context to use.
+ @param set          The Set object whose size to return.
+ @param exception    A pointer to a JSValueRef in which to store an exception, if any. Pass NULL if you do not care to store an exception.
+ @result             The number of values in set, or 0 if set is not a Set object.
+ */
+JS_EXPORT size_t JSSetGetSize(JSContextRef ctx, JSObjectRef set, JSValueRef* exception) API_AVAILABLE(macos(JSC_MAC_TBA), ios(JSC_IOS_TBA));
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* JSCollection_h */
@@ -15,6 +15,19 @@
 extern "C" {
 #endif
 
+/*!
+@enum JSDeferredFinalizationMode
+@abstract A constant identifying who runs the finalizeBatch callbacks of a context group.
+@constant kJSDeferredFinalizationBackgroundThread  Queued finalizations run in batches on a background thread owned by the context group. This is the default.
+ |-- 在上下文组自己的后台线程中批量执行排队的终结操作（默认）。
+@constant kJSDeferredFinalizationManual            Queued finalizations only run when the embedder calls JSContextGroupDrainDeferredFinalizations.
+ |-- 只有在调用JSContextGroupDrainDeferredFinalizations时才执行排队的终结操作。
+*/
+typedef enum {
+    kJSDeferredFinalizationBackgroundThread,
+    kJSDeferredFinalizationManual
+} JSDeferredFinalizationMode;
+
 /*!
 @function
 @abstract Creates a JavaScript context group.
@@ -47,6 +60,45 @@ JS_EXPORT JSContextGroupRef JSContextGroupRetain(JSContextGroupRef group) API_AV
 */
 JS_EXPORT void JSContextGroupRelease(JSContextGroupRef group) API_AVAILABLE(macos(10.6), ios(7.0));
 
+/*!
+@function
+@abstract Sets how a context group runs the finalizeBatch callbacks of its classes.
+@param group The JSContextGroup whose mode you want to set.
+@param mode A JSDeferredFinalizationMode.
+@discussion Switching to kJSDeferredFinalizationManual does not drop finalizations that are already queued; they run on the next call to JSContextGroupDrainDeferredFinalizations. When the group is destroyed, every queued finalization runs before JSContextGroupRelease returns.
+*/
+JS_EXPORT void JSContextGroupSetDeferredFinalizationMode(JSContextGroupRef group, JSDeferredFinalizationMode mode) API_AVAILABLE(macos(JSC_MAC_TBA), ios(JSC_IOS_TBA));
+
+/*!
+@function
+@abstract Runs queued finalizeBatch callbacks on the calling thread.
+ |-- 在当前线程上执行排队中的批量终结回调。
+@param group The JSContextGroup whose queued finalizations you want to run.
+@param timeBudget The maximum time to spend, in seconds. Batches are never split, so the call may overrun by up to one batch. Pass 0 to run a single batch.
+@result The number of objects whose finalization is still queued.
+@discussion This function may be called in either JSDeferredFinalizationMode, for example from an idle callback. It must not be called from within a JSObjectFinalizeBatchCallback.
+*/
+JS_EXPORT size_t JSContextGroupDrainDeferredFinalizations(JSContextGroupRef group, double timeBudget) API_AVAILABLE(macos(JSC_MAC_TBA), ios(JSC_IOS_TBA));
+
+/*!
+@function
+@abstract Sets the maximum number of compiled functions a context group keeps for JSObjectMakeFunction.
+@param group The JSContextGroup whose cache you want to bound.
+@param limit The maximum number of cached functions. When the cache is full, the least recently used entry is evicted. Pass 0 to disable the cache and discard its contents.
+@discussion The cache is enabled by default, with a limit of 256 functions. Lowering the limit evicts least recently used entries until the cache fits.
+
+Cached entries hold unlinked bytecode only, not function objects, so they do not keep any context alive.
+*/
+JS_EXPORT void JSContextGroupSetFunctionCacheLimit(JSContextGroupRef group, size_t limit) API_AVAILABLE(macos(JSC_MAC_TBA), ios(JSC_IOS_TBA));
+
+/*!
+@function
+@abstract Discards every compiled function a context group keeps for JSObjectMakeFunction.
+@param group The JSContextGroup whose cache you want to clear.
+@discussion Functions that were already created are not affected.
+*/
+JS_EXPORT void JSContextGroupClearFunctionCache(JSContextGroupRef group) API_AVAILABLE(macos(JSC_MAC_TBA), ios(JSC_IOS_TBA));
+
 /*!
 @function
 @abstract Creates a global JavaScript execution context.
@@ -138,6 +190,26 @@ JS_EXPORT JSStringRef JSGlobalContextCopyName(JSGlobalContextRef ctx) API_AVAILA
 */
 JS_EXPORT void JSGlobalContextSetName(JSGlobalContextRef ctx, JSStringRef name) API_AVAILABLE(macos(10.10), ios(8.0));
 
+/*!
+@function
+@abstract Sets how the stack of Error objects created in a context is captured.
+ |-- 设置在上下文中创建的错误对象如何捕获调用栈。
+@param ctx The JSGlobalContext whose mode you want to set.
+@param mode A JSErrorStackCaptureMode. The default is kJSErrorStackCaptureEager.
+@discussion The mode applies to every error created in ctx: by JavaScript code, by the engine itself, and by JSObjectMakeError.
+
+Independently of the mode, when a C API function such as JSValueToNumber fails and its exception parameter is NULL, an error that the function itself would throw directly back to the caller is not created at all, since nothing can observe it. Errors thrown by JavaScript code that the function runs, such as a valueOf method, are still created, since that code may catch them.
+*/
+JS_EXPORT void JSGlobalContextSetErrorStackCaptureMode(JSGlobalContextRef ctx, JSErrorStackCaptureMode mode) API_AVAILABLE(macos(JSC_MAC_TBA), ios(JSC_IOS_TBA));
+
+/*!
+@function
+@abstract Gets how the stack of Error objects created in a context is captured.
+@param ctx The JSGlobalContext whose mode you want to get.
+@result ctx's JSErrorStackCaptureMode.
+*/
+JS_EXPORT JSErrorStackCaptureMode JSGlobalContextGetErrorStackCaptureMode(JSGlobalContextRef ctx) API_AVAILABLE(macos(JSC_MAC_TBA), ios(JSC_IOS_TBA));
+
 #ifdef __cplusplus
 }
 #endif
@@ -10,6 +10,7 @@
 #include <stdbool.h>
 #endif
 #include <stddef.h> /* for size_t */
+#include <stdint.h> /* for int32_t */
 
 #ifdef __cplusplus
 extern "C" {
@@ -25,12 +26,15 @@ extern "C" {
  |--不能枚举
 @constant kJSPropertyAttributeDontDelete   Specifies that the delete operation should fail on a property.
  |-- 删除会失败
+@constant kJSPropertyAttributeCacheable    Specifies that a statically declared value property's getter returns the same value every time it is called on a given object, and has no side effects. Only meaningful in a JSStaticValue.
+ |-- 对同一个对象，getter总是返回相同的值且没有副作用，结果可以被缓存
 */
 enum {
     kJSPropertyAttributeNone         = 0,
     kJSPropertyAttributeReadOnly     = 1 << 1,
     kJSPropertyAttributeDontEnum     = 1 << 2,
-    kJSPropertyAttributeDontDelete   = 1 << 3
+    kJSPropertyAttributeDontDelete   = 1 << 3,
+    kJSPropertyAttributeCacheable    = 1 << 4
 };
 
 /*!
@@ -43,10 +47,13 @@ typedef unsigned JSPropertyAttributes;
 @enum JSClassAttribute
 @constant kJSClassAttributeNone Specifies that a class has no special attributes.
 @constant kJSClassAttributeNoAutomaticPrototype Specifies that a class should not automatically generate a shared prototype for its instance objects. Use kJSClassAttributeNoAutomaticPrototype in combination with JSObjectSetPrototype to manage prototypes manually.
+@constant kJSClassAttributeCacheMissingProperties Specifies that the set of names the class's hasProperty and getProperty callbacks answer for an object only changes when the host says so. Once those callbacks report that an object does not have a name, the engine remembers the miss and answers later lookups of that name on that object without calling them, until JSObjectInvalidateMissingProperties is called.
+ |-- 缓存回调查找失败的属性名，直到调用JSObjectInvalidateMissingProperties为止。
 */
 enum {
     kJSClassAttributeNone = 0,
-    kJSClassAttributeNoAutomaticPrototype = 1 << 1
+    kJSClassAttributeNoAutomaticPrototype = 1 << 1,
+    kJSClassAttributeCacheMissingProperties = 1 << 2
 };
 
 /*!
@@ -55,6 +62,46 @@ enum {
 */
 typedef unsigned JSClassAttributes;
 
+/*!
+@enum JSPropertyIteratorOption
+@constant kJSPropertyIteratorOptionNone            Specifies that the iterator visits the same names as JSObjectCopyPropertyNames: enumerable string keys of the object and its prototype chain, index keys included.
+ |-- 与JSObjectCopyPropertyNames访问相同的属性名
+@constant kJSPropertyIteratorOptionOwnOnly         Specifies that properties inherited from the prototype chain should be skipped.
+ |-- 跳过原型链上继承的属性
+@constant kJSPropertyIteratorOptionIncludeSymbols  Specifies that symbol keys should be visited after the string keys.
+ |-- 同时访问symbol键
+@constant kJSPropertyIteratorOptionSkipIndices     Specifies that array index keys should be skipped.
+ |-- 跳过数组索引键
+*/
+enum {
+    kJSPropertyIteratorOptionNone           = 0,
+    kJSPropertyIteratorOptionOwnOnly        = 1 << 1,
+    kJSPropertyIteratorOptionIncludeSymbols = 1 << 2,
+    kJSPropertyIteratorOptionSkipIndices    = 1 << 3
+};
+
+/*!
+@typedef JSPropertyIteratorOptions
+@abstract A set of JSPropertyIteratorOptions. Combine multiple options by logically ORing them together.
+*/
+typedef unsigned JSPropertyIteratorOptions;
+
+/*!
+@enum JSErrorStackCaptureMode
+@abstract A constant identifying how much work is done to record the stack of an Error object when it is created.
+@constant kJSErrorStackCaptureEager  The full stack trace, with function names and source positions, is captured when the error is created. This is the default.
+ |-- 创建错误对象时立即捕获完整的调用栈（默认）。
+@constant kJSErrorStackCaptureLazy   Only the code locations of the frames are recorded when the error is created. Function names and source positions are resolved, and the stack string is built, the first time the error's stack property is read.
+ |-- 创建时只记录各帧的代码位置，第一次读取stack属性时才解析并生成字符串。
+@constant kJSErrorStackCaptureNone   The stack is not walked at all. The error's stack property is the empty string.
+ |-- 完全不遍历调用栈，stack属性为空字符串。
+*/
+typedef enum {
+    kJSErrorStackCaptureEager,
+    kJSErrorStackCaptureLazy,
+    kJSErrorStackCaptureNone
+} JSErrorStackCaptureMode;
+
 /*!
 @typedef JSObjectInitializeCallback
 @abstract The callback invoked when an object is first created.
@@ -88,6 +135,22 @@ all functions that have a JSContextRef parameter.
 typedef void
 (*JSObjectFinalizeCallback) (JSObjectRef object);
 
+/*!
+@typedef JSObjectFinalizeBatchCallback
+@abstract The callback invoked with the private data of a batch of objects that have been finalized.
+@param privateData An array of the private data pointers of the finalized objects.
+@param count An integer count of the number of pointers in privateData.
+@discussion If you named your function FinalizeBatch, you would declare it like this:
+
+void FinalizeBatch(void* const privateData[], size_t count);
+
+The objects themselves are already gone when this callback runs, so it only receives their private data. Every pointer in a batch belongs to an object of the same class. Objects whose private data is NULL are not queued.
+
+This callback may run on a background thread, or inside JSContextGroupDrainDeferredFinalizations. You must not call any JavaScriptCore API from within it.
+*/
+typedef void
+(*JSObjectFinalizeBatchCallback) (void* const privateData[], size_t count);
+
 /*!
 @typedef JSObjectHasPropertyCallback
 @abstract The callback invoked when determining whether an object has a property.
@@ -274,6 +337,7 @@ typedef JSValueRef
 @field getProperty A JSObjectGetPropertyCallback to invoke when getting the property's value.
 @field setProperty A JSObjectSetPropertyCallback to invoke when setting the property's value. May be NULL if the ReadOnly attribute is set.
 @field attributes A logically ORed set of JSPropertyAttributes to give to the property.
+@discussion If attributes contains kJSPropertyAttributeCacheable, getProperty is called once per cached value: its non-NULL result is stored in the object and returned by later reads without calling back into the host, which lets the optimizing JITs load it like an ordinary data property. A NULL result is not cached, so the next read calls getProperty again. Setting the property through setProperty, or calling JSObjectInvalidateCachedProperty, discards the cached value, and the next read calls getProperty to compute a new one.
 */
 typedef struct {
     const char* name;
@@ -295,12 +359,72 @@ typedef struct {
     JSPropertyAttributes attributes;
 } JSStaticFunction;
 
+/*!
+@enum JSFastCallType
+@abstract A constant identifying the C type of an argument or return value of a JSFastCallSignature.
+@constant kJSFastCallTypeVoid     No value. Only valid as a return type; the call returns the undefined value.
+@constant kJSFastCallTypeBoolean  A C bool, converted from and to a JavaScript boolean.
+@constant kJSFastCallTypeInt32    An int32_t, converted from and to a JavaScript number that is an int32.
+@constant kJSFastCallTypeDouble   A double, converted from and to a JavaScript number.
+*/
+typedef enum {
+    kJSFastCallTypeVoid,
+    kJSFastCallTypeBoolean,
+    kJSFastCallTypeInt32,
+    kJSFastCallTypeDouble
+} JSFastCallType;
+
+/*!
+@typedef JSFastCallFunction
+@abstract A generic pointer to a C function with a typed signature. Cast your function to this type when filling in a JSFastCallSignature.
+*/
+typedef void
+(*JSFastCallFunction) (void);
+
+/*!
+@struct JSFastCallSignature
+@abstract This structure describes a C function with unboxed arguments that the optimizing JITs may call directly.
+ |-- 描述一个参数未装箱的C函数，优化JIT可以直接调用它。
+@field function The C function to call. Its real signature must match returnType and argumentTypes exactly.
+@field returnType A JSFastCallType identifying the function's return type.
+@field argumentCount An integer count of the number of types in argumentTypes.
+@field argumentTypes A JSFastCallType array identifying the type of each of the function's arguments. kJSFastCallTypeVoid is not a valid argument type.
+@discussion A function with the signature double Hypot(double, double) would be described like this:
+
+static const JSFastCallType HypotArguments[] = { kJSFastCallTypeDouble, kJSFastCallTypeDouble };
+static const JSFastCallSignature HypotSignature = { (JSFastCallFunction)Hypot, kJSFastCallTypeDouble, 2, HypotArguments };
+
+The fast function receives neither a context, the function object, nor 'this', and it has no way to report an exception. It must not call any JavaScriptCore API, must not block, and must return the same result the generic callAsFunction callback would return for the same arguments.
+*/
+typedef struct {
+    JSFastCallFunction function;
+    JSFastCallType returnType;
+    unsigned argumentCount;
+    const JSFastCallType* argumentTypes;
+} JSFastCallSignature;
+
+/*!
+@struct JSStaticFastFunction
+@abstract This structure describes a statically declared function property that has a typed fast path in addition to its generic callback.
+@field name A null-terminated UTF8 string containing the property's name.
+@field callAsFunction A JSObjectCallAsFunctionCallback to invoke when the property is called as a function and the fast path cannot be used. Must not be NULL.
+@field fastCall A JSFastCallSignature describing the typed C function to call directly.
+@field attributes A logically ORed set of JSPropertyAttributes to give to the property.
+@discussion When an optimizing JIT can prove that the call site passes at least fastCall.argumentCount arguments whose types match fastCall.argumentTypes, it calls fastCall.function directly with the unboxed arguments and boxes only the result, skipping the argument array, the exception slot and the exit from JavaScript. Every other call, including calls from the interpreter and from the baseline JIT, goes through callAsFunction.
+*/
+typedef struct {
+    const char* name;
+    JSObjectCallAsFunctionCallback callAsFunction;
+    const JSFastCallSignature* fastCall;
+    JSPropertyAttributes attributes;
+} JSStaticFastFunction;
+
 /*!
 @struct JSClassDefinition
 @abstract This structure contains properties and callbacks that define a type of object. All fields other than the version field are optional. Any pointer may be NULL.
  |-- 此结构包含定义对象类型的属性和回调。版本字段以外的所有字段都是可选的。任何指针都可以为空。
-@field version The version number of this structure. The current version is 0.
- |-- 版本此结构的版本号。当前版本为0。
+@field version The version number of this structure. The current version is 3. Version 0 ends with convertToType; fields after it are only read when version is at least the version that introduced them.
+ |-- 版本此结构的版本号。当前版本为3。版本0的结构到convertToType为止；之后的字段只有在version不小于引入该字段的版本时才会被读取。
 @field attributes  A logically ORed set of JSClassAttributes to give to the class.
 @field className A null-terminated UTF8 string containing the class's name.
  |--  包含类名称的以空结尾的UTF8字符串。
@@ -320,6 +444,15 @@ typedef struct {
 @field hasInstance The callback invoked when an object is used as the target of an 'instanceof' expression.
 @field callAsConstructor The callback invoked when an object is used as a constructor in a 'new' expression.
 @field convertToType The callback invoked when converting an object to a particular JavaScript type.
+@field staticFastFunctions (Version 1.) A JSStaticFastFunction array containing the class's statically declared function properties that have a typed fast path. Pass NULL to specify none. The array must be terminated by a JSStaticFastFunction whose name field is NULL. A name must not appear in both staticFunctions and staticFastFunctions; JSClassCreate returns NULL if it does. A name in staticFastFunctions may shadow a static function or value of parentClass, as a name in staticFunctions may.
+@field internalPointerCount (Version 2.) The number of native pointer slots to store inline in each instance object, counting the slots used by parentClass and its ancestors. Use JSObjectGetInternalPointer and JSObjectSetInternalPointer to access them.
+@field internalValueCount (Version 2.) The number of JSValue slots to store inline in each instance object, counting the slots used by parentClass and its ancestors. Values stored in these slots are visited by the garbage collector as long as the object is alive. Use JSObjectGetInternalValue and JSObjectSetInternalValue to access them.
+@field finalizeBatch (Version 3.) The callback invoked, off the sweeping path, with the private data of many finalized objects at once. If this field is non-NULL, the class's finalize callback is not called; instead, each instance's private data is queued when the instance is swept and handed to finalizeBatch later. Use this for finalizers that are expensive or that may block, like closing files.
+
+In a class chain, finalization works as follows. Only the class's own finalize callback is replaced: the finalize callbacks of the other classes in the chain still run synchronously during sweeping, in the usual order from most derived to least derived, before the private data is queued, and they must not free the private data. Each object's private data is queued exactly once, for the most derived class in its chain that sets finalizeBatch; if a parent class also sets finalizeBatch, the parent's callback does not receive that object's private data, so the pointer is never handed out twice. The parent's finalizeBatch only receives the private data of objects whose most derived batching class is the parent itself.
+
+Only the private data is queued. Internal pointer fields (see internalPointerCount) are not passed to finalizeBatch; a class that must release them should keep them reachable from its private data, or release them in a synchronous finalize callback of another class in the chain.
+ |-- 类链中：只有设置了finalizeBatch的类自身的finalize会被替换，链上其它类的finalize仍然在清扫时同步执行（不能释放私有数据）；私有数据只交给链上最派生的、设置了finalizeBatch的类，不会重复交给父类；内部指针字段不会传给finalizeBatch。
 @discussion The staticValues and staticFunctions arrays are the simplest and most efficient means for vending custom properties. Statically declared properties autmatically service requests like getProperty, setProperty, and getPropertyNames. Property access callbacks are required only to implement unusual properties, like array indexes, whose names are not known at compile-time.
 |-- staticValues和staticFunctions数组是提供自定义属性的最简单和最有效的方法。静态声明的属性自动为诸如getProperty、setProperty和getPropertyNames之类的请求提供服务。属性访问回调仅用于实现不寻常的属性，如数组索引，其名称在编译时未知。
 If you named your getter function "GetX" and your setter function "SetX", you would declare a JSStaticValue array containing "X" like this:
@@ -335,7 +468,7 @@ A NULL callback specifies that the default object callback should substitute, ex
 |--空回调指定默认对象回调应替换，但在hasProperty的情况下，它指定getProperty应替换。
 */
 typedef struct {
-    int                                 version; /* current (and only) version is 0 */
+    int                                 version; /* current version is 3 */
     JSClassAttributes                   attributes;
 
     const char*                         className;
@@ -355,16 +488,33 @@ typedef struct {
     JSObjectCallAsConstructorCallback   callAsConstructor;
     JSObjectHasInstanceCallback         hasInstance;
     JSObjectConvertToTypeCallback       convertToType;
+
+    /* Version 1 */
+    const JSStaticFastFunction*         staticFastFunctions;
+
+    /* Version 2 */
+    unsigned                            internalPointerCount;
+    unsigned                            internalValueCount;
+
+    /* Version 3 */
+    JSObjectFinalizeBatchCallback       finalizeBatch;
 } JSClassDefinition;
 
 /*!
 @const kJSClassDefinitionEmpty
-@abstract A JSClassDefinition structure of the current version, filled with NULL pointers and having no attributes.
- |-- 一种当前版本的JSClassDefinition结构，填充时没有任何指针，并且没有任何属性。
+@abstract A JSClassDefinition structure of version 0, filled with NULL pointers and having no attributes.
+ |-- 一种版本为0的JSClassDefinition结构，填充时没有任何指针，并且没有任何属性。
 @discussion Use this constant as a convenience when creating class definitions. For example, to create a class definition with only a finalize method:
 |-- 在创建类定义时，可以使用此常量。例如，要仅使用finalize方法创建类定义，请执行以下操作：
 JSClassDefinition definition = kJSClassDefinitionEmpty;
 definition.finalize = Finalize;
+
+The version field of this constant is always 0, so that code compiled against an older header, whose JSClassDefinition is smaller, never asks JSClassCreate to read fields past the end of its structure. The fields after convertToType are zero. To use a field added in a later version, set version explicitly as well:
+
+JSClassDefinition definition = kJSClassDefinitionEmpty;
+definition.version = 3;
+definition.finalizeBatch = FinalizeBatch;
+ |-- 此常量的version字段始终为0；要使用后续版本新增的字段，需要显式设置version。
 */
 JS_EXPORT extern const JSClassDefinition kJSClassDefinitionEmpty;
 
@@ -373,7 +523,9 @@ JS_EXPORT extern const JSClassDefinition kJSClassDefinitionEmpty;
 @abstract Creates a JavaScript class suitable for use with JSObjectMake.
  |--  创建适合与JSObjectMake一起使用的JavaScript类。
 @param definition A JSClassDefinition that defines the class.
-@result A JSClass with the given definition. Ownership follows the Create Rule.
+@result A JSClass with the given definition, or NULL if the definition is invalid. Ownership follows the Create Rule. A definition is invalid if a name appears in both its staticFunctions and staticFastFunctions arrays, or if it declares fewer internal pointer or internal value slots than its parentClass (see internalPointerCount and internalValueCount).
+@discussion Callbacks and the entries of staticValues, staticFunctions and staticFastFunctions are consulted class by class along the class chain, in the order described for each callback.
+ |-- 回调以及staticValues、staticFunctions和staticFastFunctions中的条目，按照各回调文档所述的顺序沿类链逐个类查询。
 */
 JS_EXPORT JSClassRef JSClassCreate(const JSClassDefinition* definition);
 
@@ -408,6 +560,50 @@ data is set on the created object before the intialize methods in its class chai
 */
 JS_EXPORT JSObjectRef JSObjectMake(JSContextRef ctx, JSClassRef jsClass, void* data);
 
+/*!
+@function
+@abstract Creates an object template with a predeclared set of properties.
+ |-- 创建一个预先声明了属性集合的对象模板。
+@param jsClass The JSClass to assign to objects made from the template. Pass NULL to use the default object class.
+@param propertyCount An integer count of the number of keys in keys.
+@param keys A JSPropertyKey array containing the names of the template's properties, in the order they should be added. Every key must be distinct, and no key may be an array index.
+@param attributes A JSPropertyAttributes array of propertyCount elements giving the attributes of each property. Pass NULL to give every property kJSPropertyAttributeNone.
+@result A JSObjectTemplate with the given class and properties, or NULL if the template is invalid. Ownership follows the Create Rule. A template is invalid if two keys are equal, if a key is an array index, if a class in jsClass's chain has a setProperty callback, or if a key has the same name as an entry in the staticValues, staticFunctions or staticFastFunctions of a class in jsClass's chain.
+@discussion Like a JSClass, a JSObjectTemplate is not tied to a context group. The final structure for the template is computed once per global object, the first time the template is used with it, and shared by every object subsequently made from the template in that global object.
+*/
+JS_EXPORT JSObjectTemplateRef JSObjectTemplateCreate(JSClassRef jsClass, size_t propertyCount, const JSPropertyKeyRef keys[], const JSPropertyAttributes attributes[]) API_AVAILABLE(macos(JSC_MAC_TBA), ios(JSC_IOS_TBA));
+
+/*!
+@function
+@abstract Retains an object template.
+@param objectTemplate The JSObjectTemplate to retain.
+@result A JSObjectTemplate that is the same as objectTemplate.
+*/
+JS_EXPORT JSObjectTemplateRef JSObjectTemplateRetain(JSObjectTemplateRef objectTemplate) API_AVAILABLE(macos(JSC_MAC_TBA), ios(JSC_IOS_TBA));
+
+/*!
+@function
+@abstract Releases an object template.
+@param objectTemplate The JSObjectTemplate to release.
+*/
+JS_EXPORT void JSObjectTemplateRelease(JSObjectTemplateRef objectTemplate) API_AVAILABLE(macos(JSC_MAC_TBA), ios(JSC_IOS_TBA));
+
+/*!
+@function
+@abstract Creates a JavaScript object from an object template.
+ |-- 使用对象模板创建JavaScript对象。
+@param ctx The execution context to use.
+@param objectTemplate The JSObjectTemplate describing the object's class and properties.
+@param values A JSValue array with one element for each of the template's properties, in the order the properties were declared. Pass NULL to initialize every property to the undefined value.
+@param data A void* to set as the object's private data. Pass NULL to specify no private data.
+@result A JSObject with the template's class and properties, and the given private data.
+@discussion The object is allocated directly with the template's final structure and values are stored straight into its property slots, so no structure transitions take place. Each property is defined directly, with the attributes given to JSObjectTemplateCreate, like Object.defineProperty: no class callback is invoked for it, and setters on the prototype chain are not called. JSObjectTemplateCreate rejects classes and keys for which this would differ from calling JSObjectSetProperty.
+
+As with JSObjectMake, data is set before the initialize methods in the class chain are called. The template's properties are stored after the initialize methods return; if an initialize method defined a property with the same name, it is replaced, attributes included.
+ |-- 模板的属性直接定义（类似Object.defineProperty），不会调用类回调或原型链上的setter；属性在initialize回调之后写入，会替换initialize定义的同名属性。
+*/
+JS_EXPORT JSObjectRef JSObjectMakeWithTemplate(JSContextRef ctx, JSObjectTemplateRef objectTemplate, const JSValueRef values[], void* data) API_AVAILABLE(macos(JSC_MAC_TBA), ios(JSC_IOS_TBA));
+
 /*!
 @function
 @abstract Convenience method for creating a JavaScript function with a given callback as its implementation.
@@ -422,6 +618,19 @@ JS_EXPORT JSObjectRef JSObjectMake(JSContextRef ctx, JSClassRef jsClass, void* d
 */
 JS_EXPORT JSObjectRef JSObjectMakeFunctionWithCallback(JSContextRef ctx, JSStringRef name, JSObjectCallAsFunctionCallback callAsFunction);
 
+/*!
+@function
+@abstract Creates a JavaScript function with a generic callback and a typed fast path.
+ |-- 创建一个同时带有通用回调和类型化快速路径的JavaScript函数。
+@param ctx The execution context to use.
+@param name A JSString containing the function's name. This will be used when converting the function to string. Pass NULL to create an anonymous function.
+@param callAsFunction The JSObjectCallAsFunctionCallback to invoke when the function is called and the fast path cannot be used. Must not be NULL.
+@param fastCall A JSFastCallSignature describing the typed C function that optimizing JITs may call directly. The signature is copied; fastCall.argumentTypes need not outlive this call.
+@result A JSObject that is a function. The object's prototype will be the default function prototype.
+@discussion See JSStaticFastFunction for when the fast path is taken.
+*/
+JS_EXPORT JSObjectRef JSObjectMakeFunctionWithFastCallback(JSContextRef ctx, JSStringRef name, JSObjectCallAsFunctionCallback callAsFunction, const JSFastCallSignature* fastCall) API_AVAILABLE(macos(JSC_MAC_TBA), ios(JSC_IOS_TBA));
+
 /*!
 @function
 @abstract Convenience method for creating a JavaScript constructor.
@@ -449,6 +658,62 @@ JS_EXPORT JSObjectRef JSObjectMakeConstructor(JSContextRef ctx, JSClassRef jsCla
  */
 JS_EXPORT JSObjectRef JSObjectMakeArray(JSContextRef ctx, size_t argumentCount, const JSValueRef arguments[], JSValueRef* exception) API_AVAILABLE(macos(10.6), ios(7.0));
 
+/*!
+ @function
+ @abstract Creates a JavaScript Array object from a buffer of doubles.
+ |--  使用double缓冲区创建JavaScript数组对象。
+ @param ctx The execution context to use.
+ @param elementCount An integer count of the number of elements in elements.
+ @param elements A buffer of elementCount doubles to copy into the Array. Pass NULL if elementCount is 0.
+ @param exception A pointer to a JSValueRef in which to store an exception, if any. Pass NULL if you do not care to store an exception.
+ @result A JSObject that is an Array, or NULL if an exception is thrown.
+ @discussion The Array is allocated with contiguous double storage and the buffer is copied into it directly, without creating a JSValue per element. NaN elements are stored as the canonical NaN.
+ */
+JS_EXPORT JSObjectRef JSObjectMakeArrayWithDoubles(JSContextRef ctx, size_t elementCount, const double elements[], JSValueRef* exception) API_AVAILABLE(macos(JSC_MAC_TBA), ios(JSC_IOS_TBA));
+
+/*!
+ @function
+ @abstract Creates a JavaScript Array object from a buffer of 32-bit integers.
+ @param ctx The execution context to use.
+ @param elementCount An integer count of the number of elements in elements.
+ @param elements A buffer of elementCount int32_t values to copy into the Array. Pass NULL if elementCount is 0.
+ @param exception A pointer to a JSValueRef in which to store an exception, if any. Pass NULL if you do not care to store an exception.
+ @result A JSObject that is an Array, or NULL if an exception is thrown.
+ @discussion The Array is allocated with contiguous int32 storage and the buffer is copied into it directly, without creating a JSValue per element.
+ */
+JS_EXPORT JSObjectRef JSObjectMakeArrayWithInt32s(JSContextRef ctx, size_t elementCount, const int32_t elements[], JSValueRef* exception) API_AVAILABLE(macos(JSC_MAC_TBA), ios(JSC_IOS_TBA));
+
+/*!
+ @function
+ @abstract Copies the elements of a JavaScript Array object into a buffer of doubles.
+ |--  将JavaScript数组的元素复制到double缓冲区中。
+ @param ctx The execution context to use.
+ @param object The Array object whose elements to copy.
+ @param buffer The destination buffer. On return, buffer contains the first min(length, bufferLength) elements of object converted to numbers. Pass NULL if bufferLength is 0.
+ @param bufferLength The number of doubles buffer can hold.
+ @param length A pointer to a size_t in which to store the length of object, which may be larger than bufferLength. Pass NULL if you do not care to know the length. Left unchanged if the function returns false.
+ @param exception A pointer to a JSValueRef in which to store an exception, if any. Pass NULL if you do not care to store an exception.
+ @result true if the elements were copied, or false if object is not an Array or an exception is thrown. An empty Array returns true with a length of 0.
+ @discussion When object has contiguous int32 or double storage, elements are copied straight out of it. Otherwise, each element is read as if by JSObjectGetPropertyAtIndex and converted as if by JSValueToNumber, so holes and non-numbers produce NaN unless their conversion yields a number, and a conversion that throws stops the copy and makes the function return false.
+
+ Call this function with a bufferLength of 0 to find out how large buffer needs to be.
+ */
+JS_EXPORT bool JSObjectCopyArrayDoubles(JSContextRef ctx, JSObjectRef object, double buffer[], size_t bufferLength, size_t* length, JSValueRef* exception) API_AVAILABLE(macos(JSC_MAC_TBA), ios(JSC_IOS_TBA));
+
+/*!
+ @function
+ @abstract Copies the elements of a JavaScript Array object into a buffer of 32-bit integers.
+ @param ctx The execution context to use.
+ @param object The Array object whose elements to copy.
+ @param buffer The destination buffer. On return, buffer contains the first min(length, bufferLength) elements of object converted to int32. Pass NULL if bufferLength is 0.
+ @param bufferLength The number of int32_t values buffer can hold.
+ @param length A pointer to a size_t in which to store the length of object, which may be larger than bufferLength. Pass NULL if you do not care to know the length. Left unchanged if the function returns false.
+ @param exception A pointer to a JSValueRef in which to store an exception, if any. Pass NULL if you do not care to store an exception.
+ @result true if the elements were copied, or false if object is not an Array or an exception is thrown. An empty Array returns true with a length of 0.
+ @discussion When object has contiguous int32 storage, elements are copied straight out of it. Otherwise, each element is read as if by JSObjectGetPropertyAtIndex and converted with the JavaScript ToInt32 operation, so holes and non-numbers produce 0 unless their conversion yields a number, and a conversion that throws stops the copy and makes the function return false.
+ */
+JS_EXPORT bool JSObjectCopyArrayInt32s(JSContextRef ctx, JSObjectRef object, int32_t buffer[], size_t bufferLength, size_t* length, JSValueRef* exception) API_AVAILABLE(macos(JSC_MAC_TBA), ios(JSC_IOS_TBA));
+
 /*!
  @function
  @abstract Creates a JavaScript Date object, as if by invoking the built-in Date constructor.
@@ -473,6 +738,19 @@ JS_EXPORT JSObjectRef JSObjectMakeDate(JSContextRef ctx, size_t argumentCount, c
  */
 JS_EXPORT JSObjectRef JSObjectMakeError(JSContextRef ctx, size_t argumentCount, const JSValueRef arguments[], JSValueRef* exception) API_AVAILABLE(macos(10.6), ios(7.0));
 
+/*!
+ @function
+ @abstract Creates a JavaScript Error object, choosing how its stack is captured.
+ @param ctx The execution context to use.
+ @param stackCaptureMode A JSErrorStackCaptureMode to use for this error, overriding the mode set on ctx's global context.
+ @param argumentCount An integer count of the number of arguments in arguments.
+ @param arguments A JSValue array of arguments to pass to the Error Constructor. Pass NULL if argumentCount is 0.
+ @param exception A pointer to a JSValueRef in which to store an exception, if any. Pass NULL if you do not care to store an exception.
+ @result A JSObject that is a Error.
+ @discussion Use kJSErrorStackCaptureNone for errors that a host callback returns to signal an expected failure, such as a validation miss, when nothing will look at their stack.
+ */
+JS_EXPORT JSObjectRef JSObjectMakeErrorWithStackCaptureMode(JSContextRef ctx, JSErrorStackCaptureMode stackCaptureMode, size_t argumentCount, const JSValueRef arguments[], JSValueRef* exception) API_AVAILABLE(macos(JSC_MAC_TBA), ios(JSC_IOS_TBA));
+
 /*!
  @function
  @abstract Creates a JavaScript RegExp object, as if by invoking the built-in RegExp constructor.
@@ -508,6 +786,9 @@ JS_EXPORT JSObjectRef JSObjectMakeDeferredPromise(JSContextRef ctx, JSObjectRef*
 @param exception A pointer to a JSValueRef in which to store a syntax error exception, if any. Pass NULL if you do not care to store a syntax error exception.
 @result A JSObject that is a function, or NULL if either body or parameterNames contains a syntax error. The object's prototype will be the default function prototype.
 @discussion Use this method when you want to execute a script repeatedly, to avoid the cost of re-parsing the script before each execution.
+
+The compiled function is kept in a cache owned by ctx's context group, keyed by a hash of name, parameterNames, body, sourceURL and startingLineNumber. A hash match is only used after the full name, every parameter name, body, sourceURL and startingLineNumber have been compared with the cached entry's and found equal, so a hash collision never returns another function's code. A later call with the same inputs, in any context of the group, finds the compiled code there and only creates a new function object in its context, without parsing or generating bytecode again. The cache is enabled by default; use JSContextGroupSetFunctionCacheLimit to bound or disable it.
+ |-- 编译结果缓存在上下文组中，以name、parameterNames、body、sourceURL和startingLineNumber的哈希为键。同一组中任何上下文以相同输入再次调用时，只需创建新的函数对象，不需要重新解析和生成字节码。
 */
 JS_EXPORT JSObjectRef JSObjectMakeFunction(JSContextRef ctx, JSStringRef name, unsigned parameterCount, const JSStringRef parameterNames[], JSStringRef body, JSStringRef sourceURL, int startingLineNumber, JSValueRef* exception);
 
@@ -623,6 +904,69 @@ JS_EXPORT void JSObjectSetPropertyForKey(JSContextRef ctx, JSObjectRef object, J
  */
 JS_EXPORT bool JSObjectDeletePropertyForKey(JSContextRef ctx, JSObjectRef object, JSValueRef propertyKey, JSValueRef* exception) API_AVAILABLE(macos(10.15), ios(13.0));
 
+/*!
+ @function
+ @abstract Creates a prepared property key from a JavaScript string.
+ |-- 从JavaScript字符串创建预处理的属性键。
+ @param propertyName A JSString containing the property's name.
+ @result A JSPropertyKey for propertyName. Ownership follows the Create Rule.
+ @discussion A JSPropertyKey is not tied to a context group. The name is hashed once when the key is created, and interned the first time the key is used in each context group, so repeated lookups through the same key skip both steps.
+ */
+JS_EXPORT JSPropertyKeyRef JSPropertyKeyCreate(JSStringRef propertyName) API_AVAILABLE(macos(JSC_MAC_TBA), ios(JSC_IOS_TBA));
+
+/*!
+ @function
+ @abstract Creates a prepared property key from a null-terminated UTF8 string.
+ @param propertyName The null-terminated UTF8 string containing the property's name.
+ @result A JSPropertyKey for propertyName. Ownership follows the Create Rule.
+ */
+JS_EXPORT JSPropertyKeyRef JSPropertyKeyCreateWithUTF8CString(const char* propertyName) API_AVAILABLE(macos(JSC_MAC_TBA), ios(JSC_IOS_TBA));
+
+/*!
+ @function
+ @abstract Retains a prepared property key.
+ @param key The JSPropertyKey to retain.
+ @result A JSPropertyKey that is the same as key.
+ */
+JS_EXPORT JSPropertyKeyRef JSPropertyKeyRetain(JSPropertyKeyRef key) API_AVAILABLE(macos(JSC_MAC_TBA), ios(JSC_IOS_TBA));
+
+/*!
+ @function
+ @abstract Releases a prepared property key.
+ @param key The JSPropertyKey to release.
+ */
+JS_EXPORT void JSPropertyKeyRelease(JSPropertyKeyRef key) API_AVAILABLE(macos(JSC_MAC_TBA), ios(JSC_IOS_TBA));
+
+/*!
+ @function
+ @abstract Gets several properties from an object in one call.
+ |-- 一次调用获取对象的多个属性。
+ @param ctx The execution context to use.
+ @param object The JSObject whose properties you want to get.
+ @param propertyCount An integer count of the number of keys in keys.
+ @param keys A JSPropertyKey array containing the names of the properties to get.
+ @param values A JSValue array of at least propertyCount elements. On return, values[i] contains the value of the property named by keys[i], or the undefined value if object has no such property.
+ @param exception A pointer to a JSValueRef in which to store an exception, if any. Pass NULL if you do not care to store an exception.
+ @result true if every property was read, otherwise false. If a getter throws, the remaining elements of values are set to NULL and the exception is stored in exception.
+ @discussion Calling JSObjectGetProperties is equivalent to calling JSObjectGetProperty once for each key, in order, but the API lock is taken only once and object's structure is checked only once. When object has no custom property callbacks and no accessors for the requested keys, the values are read straight from its property storage.
+ */
+JS_EXPORT bool JSObjectGetProperties(JSContextRef ctx, JSObjectRef object, size_t propertyCount, const JSPropertyKeyRef keys[], JSValueRef values[], JSValueRef* exception) API_AVAILABLE(macos(JSC_MAC_TBA), ios(JSC_IOS_TBA));
+
+/*!
+ @function
+ @abstract Sets several properties on an object in one call.
+ @param ctx The execution context to use.
+ @param object The JSObject whose properties you want to set.
+ @param propertyCount An integer count of the number of keys in keys.
+ @param keys A JSPropertyKey array containing the names of the properties to set.
+ @param values A JSValue array of propertyCount elements. values[i] is used as the value of the property named by keys[i].
+ @param attributes A logically ORed set of JSPropertyAttributes to give to every property.
+ @param exception A pointer to a JSValueRef in which to store an exception, if any. Pass NULL if you do not care to store an exception.
+ @result true if every property was set, otherwise false. If a setter throws, the remaining properties are not set and the exception is stored in exception.
+ @discussion Calling JSObjectSetProperties is equivalent to calling JSObjectSetProperty once for each key, in order, but the API lock is taken only once. When object already has all of the keys as plain data properties, its structure is checked once and the values are stored directly.
+ */
+JS_EXPORT bool JSObjectSetProperties(JSContextRef ctx, JSObjectRef object, size_t propertyCount, const JSPropertyKeyRef keys[], const JSValueRef values[], JSPropertyAttributes attributes, JSValueRef* exception) API_AVAILABLE(macos(JSC_MAC_TBA), ios(JSC_IOS_TBA));
+
 /*!
 @function
 @abstract Gets a property from an object by numeric index.
@@ -648,6 +992,61 @@ JS_EXPORT JSValueRef JSObjectGetPropertyAtIndex(JSContextRef ctx, JSObjectRef ob
 */
 JS_EXPORT void JSObjectSetPropertyAtIndex(JSContextRef ctx, JSObjectRef object, unsigned propertyIndex, JSValueRef value, JSValueRef* exception);
 
+/*!
+@function
+@abstract Gets a range of properties from an object by numeric index.
+ |-- 按数字索引范围批量获取对象的属性。
+@param ctx The execution context to use.
+@param object The JSObject whose properties you want to get.
+@param startIndex The index of the first property to get.
+@param count An integer count of the number of properties to get.
+@param values A JSValue array of at least count elements. On return, values[i] contains the value of the property at startIndex + i, or the undefined value if object has no such property.
+@param exception A pointer to a JSValueRef in which to store an exception, if any. Pass NULL if you do not care to store an exception.
+@result true if every property was read, otherwise false. If a getter throws, the remaining elements of values are set to NULL.
+@discussion startIndex + count must not exceed 4294967295, so that every index in the range is a valid array index (at most 4294967294). Otherwise no property is read, a RangeError is thrown and the function returns false.
+
+Calling JSObjectGetPropertiesAtIndexRange is equivalent to calling JSObjectGetPropertyAtIndex for each index in [startIndex, startIndex + count), in order. When the part of the range that lies within object's dense indexed storage has no holes, it is copied out in one pass; holes, indices beyond the dense storage, and exotic objects such as Proxies or objects with a getProperty callback fall back to the generic per-index get.
+*/
+JS_EXPORT bool JSObjectGetPropertiesAtIndexRange(JSContextRef ctx, JSObjectRef object, unsigned startIndex, size_t count, JSValueRef values[], JSValueRef* exception) API_AVAILABLE(macos(JSC_MAC_TBA), ios(JSC_IOS_TBA));
+
+/*!
+@function
+@abstract Sets a range of properties on an object by numeric index.
+@param ctx The execution context to use.
+@param object The JSObject whose properties you want to set.
+@param startIndex The index of the first property to set.
+@param count An integer count of the number of values in values.
+@param values A JSValue array of count elements. values[i] is used as the value of the property at startIndex + i.
+@param exception A pointer to a JSValueRef in which to store an exception, if any. Pass NULL if you do not care to store an exception.
+@result true if every property was set, otherwise false. If a setter throws, the remaining properties are not set.
+@discussion startIndex + count must not exceed 4294967295, so that every index in the range is a valid array index (at most 4294967294). Otherwise no property is set, a RangeError is thrown and the function returns false.
+
+Calling JSObjectSetPropertiesAtIndexRange is equivalent to calling JSObjectSetPropertyAtIndex for each index in [startIndex, startIndex + count), in order. When object is an ordinary Array with no indexed accessors, its storage is grown once and the values are stored directly; exotic objects fall back to the generic per-index put.
+*/
+JS_EXPORT bool JSObjectSetPropertiesAtIndexRange(JSContextRef ctx, JSObjectRef object, unsigned startIndex, size_t count, const JSValueRef values[], JSValueRef* exception) API_AVAILABLE(macos(JSC_MAC_TBA), ios(JSC_IOS_TBA));
+
+/*!
+@function
+@abstract Discards the cached value of a cacheable statically declared value property.
+ |-- 丢弃可缓存静态属性的缓存值。
+@param ctx The execution context to use.
+@param object The JSObject whose cached value you want to discard.
+@param propertyName A JSPropertyKey containing the name of a JSStaticValue declared with kJSPropertyAttributeCacheable. Pass NULL to discard every cached value on object.
+@discussion Call this when the value a cacheable getter would return for object has changed. The next read of the property calls the getter again. Code that the JIT compiled against the old value is invalidated.
+*/
+JS_EXPORT void JSObjectInvalidateCachedProperty(JSContextRef ctx, JSObjectRef object, JSPropertyKeyRef propertyName) API_AVAILABLE(macos(JSC_MAC_TBA), ios(JSC_IOS_TBA));
+
+/*!
+@function
+@abstract Tells the engine that an object's property callbacks may now answer differently for names they previously did not have.
+ |-- 通知引擎：对象的属性回调对之前不存在的属性名可能有了不同的结果。
+@param ctx The execution context to use.
+@param object The JSObject whose remembered misses you want to discard. Its class chain must include a class with kJSClassAttributeCacheMissingProperties; otherwise this function does nothing.
+@param propertyName A JSPropertyKey containing the name that may now exist. Pass NULL to discard every remembered miss on object.
+@discussion Only the class callbacks are skipped for a remembered miss. Statically declared properties, properties stored on the object and its prototype chain are still looked up as usual, and any property set, defined or deleted on object through the engine discards the remembered miss for that name automatically. Call this function when the host changes what its callbacks return behind the engine's back.
+*/
+JS_EXPORT void JSObjectInvalidateMissingProperties(JSContextRef ctx, JSObjectRef object, JSPropertyKeyRef propertyName) API_AVAILABLE(macos(JSC_MAC_TBA), ios(JSC_IOS_TBA));
+
 /*!
 @function
 @abstract Gets an object's private data.
@@ -668,6 +1067,51 @@ JS_EXPORT void* JSObjectGetPrivate(JSObjectRef object);
 */
 JS_EXPORT bool JSObjectSetPrivate(JSObjectRef object, void* data);
 
+/*!
+@function
+@abstract Gets a native pointer stored in one of an object's internal fields.
+ |-- 获取对象内部字段中保存的原生指针。
+@param object A JSObject whose internal field you want to get.
+@param index The index of the internal pointer field, less than the object's internalPointerCount.
+@result The void* stored in the field, or NULL if the field has not been set or index is out of range.
+@discussion Internal field indices are shared by every class in an object's class chain: index 0 means the same slot whether it is accessed from a callback of the derived class or of its parent. A derived class must therefore reserve its ancestors' slots by declaring an internalPointerCount and internalValueCount at least as large as its parent's, and use only the indices from the parent's count upwards for its own fields. JSClassCreate returns NULL if a class declares fewer internal fields of either kind than its parent class. An object has the internal field counts of its most derived class.
+
+Internal fields are stored in the object itself, next to its private data, so reading one does not chase a pointer to a separately allocated structure.
+*/
+JS_EXPORT void* JSObjectGetInternalPointer(JSObjectRef object, unsigned index) API_AVAILABLE(macos(JSC_MAC_TBA), ios(JSC_IOS_TBA));
+
+/*!
+@function
+@abstract Sets a native pointer in one of an object's internal fields.
+@param object The JSObject whose internal field you want to set.
+@param index The index of the internal pointer field, less than the object's internalPointerCount.
+@param data A void* to store in the field.
+@result true if object has an internal pointer field at index, otherwise false.
+*/
+JS_EXPORT bool JSObjectSetInternalPointer(JSObjectRef object, unsigned index, void* data) API_AVAILABLE(macos(JSC_MAC_TBA), ios(JSC_IOS_TBA));
+
+/*!
+@function
+@abstract Gets a JavaScript value stored in one of an object's internal fields.
+@param ctx The execution context to use.
+@param object A JSObject whose internal field you want to get.
+@param index The index of the internal value field, less than the object's internalValueCount.
+@result The JSValue stored in the field, or NULL if the field has not been set or index is out of range.
+*/
+JS_EXPORT JSValueRef JSObjectGetInternalValue(JSContextRef ctx, JSObjectRef object, unsigned index) API_AVAILABLE(macos(JSC_MAC_TBA), ios(JSC_IOS_TBA));
+
+/*!
+@function
+@abstract Sets a JavaScript value in one of an object's internal fields.
+@param ctx The execution context to use.
+@param object The JSObject whose internal field you want to set.
+@param index The index of the internal value field, less than the object's internalValueCount.
+@param value A JSValue to store in the field. Pass NULL to clear the field.
+@result true if object has an internal value field at index, otherwise false.
+@discussion The value stays alive for as long as object does, without a call to JSValueProtect. Unlike a property, an internal field is invisible to JavaScript.
+*/
+JS_EXPORT bool JSObjectSetInternalValue(JSContextRef ctx, JSObjectRef object, unsigned index, JSValueRef value) API_AVAILABLE(macos(JSC_MAC_TBA), ios(JSC_IOS_TBA));
+
 /*!
 @function
 @abstract Tests whether an object can be called as a function.
@@ -690,6 +1134,49 @@ JS_EXPORT bool JSObjectIsFunction(JSContextRef ctx, JSObjectRef object);
 */
 JS_EXPORT JSValueRef JSObjectCallAsFunction(JSContextRef ctx, JSObjectRef object, JSObjectRef thisObject, size_t argumentCount, const JSValueRef arguments[], JSValueRef* exception);
 
+/*!
+@function
+@abstract Prepares an object to be called as a function many times with the same 'this' object and argument count.
+ |-- 预先准备好一次函数调用，以便用相同的this对象和参数个数重复调用。
+@param ctx The execution context to use.
+@param object The JSObject to call as a function.
+@param thisObject The object to use as "this," or NULL to use the global object as "this."
+@param argumentCount An integer count of the number of arguments every call will pass.
+@param exception A pointer to a JSValueRef in which to store an exception, if any. Pass NULL if you do not care to store an exception.
+@result A JSPreparedCall, or NULL if object is not a function or an exception is thrown. Ownership follows the Create Rule.
+@discussion The callee is checked and resolved once here, and the prepared call owns a frame with room for argumentCount arguments, so JSPreparedCallInvoke does not repeat those checks or allocate argument storage. When the callee is a JavaScript function, JSPreparedCallInvoke enters it directly rather than through the generic call trampoline.
+
+A prepared call keeps object and thisObject alive until it is released. It may only be invoked with contexts in the same context group as ctx.
+*/
+JS_EXPORT JSPreparedCallRef JSObjectCreatePreparedCall(JSContextRef ctx, JSObjectRef object, JSObjectRef thisObject, size_t argumentCount, JSValueRef* exception) API_AVAILABLE(macos(JSC_MAC_TBA), ios(JSC_IOS_TBA));
+
+/*!
+@function
+@abstract Calls a prepared function.
+@param ctx The execution context to use.
+@param preparedCall The JSPreparedCall to invoke.
+@param arguments A JSValue array of exactly the number of arguments given to JSObjectCreatePreparedCall. Pass NULL if that count is 0.
+@param exception A pointer to a JSValueRef in which to store an exception, if any. Pass NULL if you do not care to store an exception.
+@result The JSValue that results from calling the function, or NULL if an exception is thrown.
+@discussion Calling JSPreparedCallInvoke is equivalent to calling JSObjectCallAsFunction with the object, thisObject and arguments the call was prepared with. A prepared call is not reentrant: if the function being called invokes the same prepared call again, the inner invocation behaves like JSObjectCallAsFunction and does not reuse the frame.
+*/
+JS_EXPORT JSValueRef JSPreparedCallInvoke(JSContextRef ctx, JSPreparedCallRef preparedCall, const JSValueRef arguments[], JSValueRef* exception) API_AVAILABLE(macos(JSC_MAC_TBA), ios(JSC_IOS_TBA));
+
+/*!
+@function
+@abstract Retains a prepared call.
+@param preparedCall The JSPreparedCall to retain.
+@result A JSPreparedCall that is the same as preparedCall.
+*/
+JS_EXPORT JSPreparedCallRef JSPreparedCallRetain(JSPreparedCallRef preparedCall) API_AVAILABLE(macos(JSC_MAC_TBA), ios(JSC_IOS_TBA));
+
+/*!
+@function
+@abstract Releases a prepared call.
+@param preparedCall The JSPreparedCall to release.
+*/
+JS_EXPORT void JSPreparedCallRelease(JSPreparedCallRef preparedCall) API_AVAILABLE(macos(JSC_MAC_TBA), ios(JSC_IOS_TBA));
+
 /*!
 @function
 @abstract Tests whether an object can be called as a constructor.
@@ -756,6 +1243,48 @@ JS_EXPORT size_t JSPropertyNameArrayGetCount(JSPropertyNameArrayRef array);
 */
 JS_EXPORT JSStringRef JSPropertyNameArrayGetNameAtIndex(JSPropertyNameArrayRef array, size_t index);
 
+/*!
+@function
+@abstract Creates an iterator over the names of an object's properties.
+ |-- 创建一个遍历对象属性名的迭代器。
+@param ctx The execution context to use.
+@param object The object whose property names you want to iterate.
+@param options A logically ORed set of JSPropertyIteratorOptions selecting which names to visit.
+@result A JSPropertyIterator positioned before the first name. Ownership follows the Create Rule.
+@discussion Unlike JSObjectCopyPropertyNames, an iterator does not materialize the full list of names up front, and it yields names as JSValues, so no JSString is allocated per name. When object has no getPropertyNames callback and no indexed properties, the iterator walks the enumeration order cached on object's structure, which is shared by every object with the same structure.
+
+Names are visited in the same order as a JavaScript for...in loop. Properties added to object after the iterator is created may or may not be visited; properties deleted before they are reached are skipped.
+*/
+JS_EXPORT JSPropertyIteratorRef JSObjectCreatePropertyIterator(JSContextRef ctx, JSObjectRef object, JSPropertyIteratorOptions options) API_AVAILABLE(macos(JSC_MAC_TBA), ios(JSC_IOS_TBA));
+
+/*!
+@function
+@abstract Advances a property iterator to the next property name.
+@param ctx The execution context to use.
+@param iterator The JSPropertyIterator to advance.
+@param name A pointer to a JSValueRef in which to store the next property name, which is either a string or a symbol.
+@param value A pointer to a JSValueRef in which to store the value of the property, as if by JSObjectGetPropertyForKey. Pass NULL if you only need the name, in which case no getter is run.
+@param exception A pointer to a JSValueRef in which to store an exception, if any. Pass NULL if you do not care to store an exception.
+@result true if a name was stored in name, or false if the iteration is finished or an exception was thrown.
+*/
+JS_EXPORT bool JSPropertyIteratorNext(JSContextRef ctx, JSPropertyIteratorRef iterator, JSValueRef* name, JSValueRef* value, JSValueRef* exception) API_AVAILABLE(macos(JSC_MAC_TBA), ios(JSC_IOS_TBA));
+
+/*!
+@function
+@abstract Retains a property iterator.
+@param iterator The JSPropertyIterator to retain.
+@result A JSPropertyIterator that is the same as iterator.
+*/
+JS_EXPORT JSPropertyIteratorRef JSPropertyIteratorRetain(JSPropertyIteratorRef iterator) API_AVAILABLE(macos(JSC_MAC_TBA), ios(JSC_IOS_TBA));
+
+/*!
+@function
+@abstract Releases a property iterator.
+@param iterator The JSPropertyIterator to release.
+@discussion An iterator keeps the object it iterates alive until the iterator is released.
+*/
+JS_EXPORT void JSPropertyIteratorRelease(JSPropertyIteratorRef iterator) API_AVAILABLE(macos(JSC_MAC_TBA), ios(JSC_IOS_TBA));
+
 /*!
 @function
 @abstract Adds a property name to a JavaScript property name accumulator.
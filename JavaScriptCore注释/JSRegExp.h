@@ -0,0 +1,115 @@
+#ifndef JSRegExp_h
+#define JSRegExp_h
+
+#include <JavaScriptCore/JSBase.h>
+#include <JavaScriptCore/JSValueRef.h>
+#include <JavaScriptCore/WebKitAvailability.h>
+
+#ifndef __cplusplus
+#include <stdbool.h>
+#endif
+#include <stddef.h> /* for size_t */
+#include <stdint.h> /* for SIZE_MAX */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ @define kJSRegExpNotFound
+ @abstract The offset stored for a capture group that did not participate in a match.
+ @discussion This is a constant expression, so it may be used in case labels and static initializers.
+ */
+#define kJSRegExpNotFound SIZE_MAX
+
+/*!
+ @function
+ @abstract           Compiles a regular expression.
+ |--  编译一个正则表达式。
+ @param ctx          The execution context to use.
+ @param pattern      A JSString containing the pattern, with the same syntax as the built-in RegExp constructor.
+ @param flags        A JSString containing the flags, with the same syntax as the built-in RegExp constructor. Pass NULL to specify no flags.
+ @param exception    A pointer to a JSValueRef in which to store a syntax error exception, if any. Pass NULL if you do not care to store an exception.
+ @result             A JSRegExp, or NULL if pattern or flags contains a syntax error. Ownership follows the Create Rule.
+ @discussion         The pattern is parsed once here. The matcher is compiled by the regular expression JIT the first time it is needed for 8-bit or 16-bit input, and the compiled code is kept for the lifetime of the JSRegExp, which may be used with any context in ctx's context group.
+
+ The g flag has no effect, since a JSRegExp has no lastIndex; the y flag anchors each match at the start index passed to the match function.
+ */
+JS_EXPORT JSRegExpRef JSRegExpCreate(JSContextRef ctx, JSStringRef pattern, JSStringRef flags, JSValueRef* exception) API_AVAILABLE(macos(JSC_MAC_TBA), ios(JSC_IOS_TBA));
+
+/*!
+ @function
+ @abstract           Retains a compiled regular expression.
+ @param regExp       The JSRegExp to retain.
+ @result             A JSRegExp that is the same as regExp.
+ */
+JS_EXPORT JSRegExpRef JSRegExpRetain(JSRegExpRef regExp) API_AVAILABLE(macos(JSC_MAC_TBA), ios(JSC_IOS_TBA));
+
+/*!
+ @function
+ @abstract           Releases a compiled regular expression.
+ @param regExp       The JSRegExp to release.
+ */
+JS_EXPORT void JSRegExpRelease(JSRegExpRef regExp) API_AVAILABLE(macos(JSC_MAC_TBA), ios(JSC_IOS_TBA));
+
+/*!
+ @function
+ @abstract           Returns the number of capture groups in a compiled regular expression.
+ @param regExp       The JSRegExp whose capture groups to count.
+ @result             The number of capture groups, not counting the implicit group for the whole match. A buffer of (1 + result) * 2 offsets holds every capture.
+ */
+JS_EXPORT size_t JSRegExpGetCaptureCount(JSRegExpRef regExp) API_AVAILABLE(macos(JSC_MAC_TBA), ios(JSC_IOS_TBA));
+
+/*!
+ @function
+ @abstract           Matches a compiled regular expression against a JavaScript string.
+ |--  用编译好的正则表达式匹配JavaScript字符串。
+ @param ctx          The execution context to use.
+ @param regExp       The JSRegExp to match.
+ @param subject      The JSString to search.
+ @param startIndex   The index, in UTF-16 code units, at which to start searching. If it is greater than the length of subject, the function returns false without throwing an exception.
+ @param offsets      A buffer that receives, for the whole match and then for each capture group in order, the start and end index of the match. Groups that did not participate are set to kJSRegExpNotFound. Pass NULL if offsetCount is 0.
+ @param offsetCount  The number of elements offsets can hold. Groups that do not fit are not reported. Only whole start and end pairs are written: if offsetCount is odd, the last element of offsets is left unchanged.
+ @param exception    A pointer to a JSValueRef in which to store an exception, if any. Pass NULL if you do not care to store an exception.
+ @result             true if regExp matched, otherwise false. If false, offsets is left unchanged.
+ @discussion         No JavaScript objects are allocated. An exception is only thrown if the match cannot complete, for example because it ran out of stack.
+ */
+JS_EXPORT bool JSRegExpMatch(JSContextRef ctx, JSRegExpRef regExp, JSStringRef subject, size_t startIndex, size_t offsets[], size_t offsetCount, JSValueRef* exception) API_AVAILABLE(macos(JSC_MAC_TBA), ios(JSC_IOS_TBA));
+
+/*!
+ @function
+ @abstract           Matches a compiled regular expression against a buffer of Latin-1 characters.
+ @param ctx          The execution context to use.
+ @param regExp       The JSRegExp to match.
+ @param characters   The Latin-1 characters to search. The buffer is not copied and need not be null-terminated.
+ @param length       The number of characters in characters.
+ @param startIndex   The index at which to start searching. If it is greater than length, the function returns false without throwing an exception.
+ @param offsets      A buffer that receives the match offsets, as for JSRegExpMatch.
+ @param offsetCount  The number of elements offsets can hold. If it is odd, the last element of offsets is left unchanged, as for JSRegExpMatch.
+ @param exception    A pointer to a JSValueRef in which to store an exception, if any. Pass NULL if you do not care to store an exception.
+ @result             true if regExp matched, otherwise false.
+ @discussion         The 8-bit matcher runs directly on characters. Each byte is one character, from U+0000 to U+00FF.
+ */
+JS_EXPORT bool JSRegExpMatchLatin1(JSContextRef ctx, JSRegExpRef regExp, const unsigned char* characters, size_t length, size_t startIndex, size_t offsets[], size_t offsetCount, JSValueRef* exception) API_AVAILABLE(macos(JSC_MAC_TBA), ios(JSC_IOS_TBA));
+
+/*!
+ @function
+ @abstract           Matches a compiled regular expression against a buffer of UTF-8 bytes.
+ @param ctx          The execution context to use.
+ @param regExp       The JSRegExp to match.
+ @param bytes        The UTF-8 bytes to search. The buffer need not be null-terminated.
+ @param length       The number of bytes in bytes.
+ @param startIndex   The byte offset at which to start searching. If it falls inside a multi-byte character, it is rounded down to the first byte of that character. If it is greater than length, the function returns false without throwing an exception.
+ @param offsets      A buffer that receives the match offsets, as for JSRegExpMatch, but as byte offsets into bytes.
+ @param offsetCount  The number of elements offsets can hold. If it is odd, the last element of offsets is left unchanged, as for JSRegExpMatch.
+ @param exception    A pointer to a JSValueRef in which to store an exception, if any. Pass NULL if you do not care to store an exception.
+ @result             true if regExp matched, otherwise false. Invalid UTF-8 sequences are treated as U+FFFD.
+ @discussion         When bytes is entirely ASCII, the 8-bit matcher runs directly on it. Otherwise the input is transcoded to UTF-16 into a buffer owned by regExp, which is reused across calls, and the offsets are mapped back to bytes.
+ */
+JS_EXPORT bool JSRegExpMatchUTF8(JSContextRef ctx, JSRegExpRef regExp, const char* bytes, size_t length, size_t startIndex, size_t offsets[], size_t offsetCount, JSValueRef* exception) API_AVAILABLE(macos(JSC_MAC_TBA), ios(JSC_IOS_TBA));
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* JSRegExp_h */
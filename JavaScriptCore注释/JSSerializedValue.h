@@ -0,0 +1,90 @@
+#ifndef JSSerializedValue_h
+#define JSSerializedValue_h
+
+#include <JavaScriptCore/JSBase.h>
+#include <JavaScriptCore/JSValueRef.h>
+#include <JavaScriptCore/WebKitAvailability.h>
+
+#include <stddef.h> /* for size_t */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ @function
+ @abstract               Serializes a JavaScript value with the structured clone algorithm.
+ |--  使用结构化克隆算法序列化一个JavaScript值。
+ @param ctx              The execution context to use.
+ @param value            The value to serialize.
+ @param transferCount    An integer count of the number of objects in transferList.
+ @param transferList     A JSObject array of Array Buffer objects whose contents should be transferred rather than copied. Pass NULL if transferCount is 0.
+ @param exception        A pointer to a JSValueRef in which to store an exception, if any. Pass NULL if you do not care to store an exception.
+ @result                 A JSSerializedValue, or NULL if value cannot be serialized. Ownership follows the Create Rule.
+ @discussion             The primitive values undefined, null, booleans, numbers, BigInts and strings, plain objects, Arrays, Boolean, Number and String objects, Dates, RegExps, Maps, Sets, Errors, Array Buffers, Typed Arrays and DataViews are preserved with their types. Cycles and objects reachable through more than one path are preserved as well. Functions, symbols, Proxies and objects created with a JSClass cannot be serialized, and throw a DataCloneError.
+
+ The contents of each Array Buffer in transferList are moved into the JSSerializedValue without copying, and the Array Buffer is detached, exactly as postMessage does with transferables. Typed Arrays that view a transferred Array Buffer keep viewing it after deserialization.
+
+ A JSSerializedValue may be passed to, and deserialized on, any thread. Its serialized bytes never change after this function returns; the only state that changes later is the ownership of transferred Array Buffer contents, which is claimed atomically by the first deserialization (see JSSerializedValueDeserialize).
+ */
+JS_EXPORT JSSerializedValueRef JSSerializedValueCreate(JSContextRef ctx, JSValueRef value, size_t transferCount, const JSObjectRef transferList[], JSValueRef* exception) API_AVAILABLE(macos(JSC_MAC_TBA), ios(JSC_IOS_TBA));
+
+/*!
+ @function
+ @abstract               Creates a JavaScript value from a serialized value.
+ |--  从序列化值创建JavaScript值。
+ @param ctx              The execution context in which to create the value. It may belong to any context group.
+ @param serializedValue  The JSSerializedValue to deserialize.
+ @param exception        A pointer to a JSValueRef in which to store an exception, if any. Pass NULL if you do not care to store an exception.
+ @result                 A new JSValue equivalent to the one that was serialized, or NULL if an exception is thrown.
+ @discussion             A JSSerializedValue without transferred Array Buffers may be deserialized any number of times. One that carries transferred Array Buffers hands their contents to the first deserialization; later attempts throw a DataCloneError. If several threads deserialize such a value at the same time, exactly one of them claims the contents and succeeds, and every other one throws a DataCloneError without creating any object.
+ */
+JS_EXPORT JSValueRef JSSerializedValueDeserialize(JSContextRef ctx, JSSerializedValueRef serializedValue, JSValueRef* exception) API_AVAILABLE(macos(JSC_MAC_TBA), ios(JSC_IOS_TBA));
+
+/*!
+ @function
+ @abstract               Retains a serialized value.
+ @param serializedValue  The JSSerializedValue to retain.
+ @result                 A JSSerializedValue that is the same as serializedValue.
+ */
+JS_EXPORT JSSerializedValueRef JSSerializedValueRetain(JSSerializedValueRef serializedValue) API_AVAILABLE(macos(JSC_MAC_TBA), ios(JSC_IOS_TBA));
+
+/*!
+ @function
+ @abstract               Releases a serialized value.
+ @param serializedValue  The JSSerializedValue to release.
+ @discussion             If the value still owns the contents of transferred Array Buffers because it was never deserialized, they are freed with their original deallocators.
+ */
+JS_EXPORT void JSSerializedValueRelease(JSSerializedValueRef serializedValue) API_AVAILABLE(macos(JSC_MAC_TBA), ios(JSC_IOS_TBA));
+
+/*!
+ @function
+ @abstract               Returns a pointer to the wire format of a serialized value.
+ @param serializedValue  The JSSerializedValue whose bytes to return.
+ @result                 A pointer to the serialized bytes, which remain valid until serializedValue is released, or NULL if serializedValue carries transferred Array Buffers.
+ @discussion             Use this function and JSSerializedValueGetByteLength to send a serialized value to another process. The wire format is only guaranteed to be readable by the same version of JavaScriptCore.
+ */
+JS_EXPORT const void* JSSerializedValueGetBytesPtr(JSSerializedValueRef serializedValue) API_AVAILABLE(macos(JSC_MAC_TBA), ios(JSC_IOS_TBA));
+
+/*!
+ @function
+ @abstract               Returns the length of the wire format of a serialized value.
+ @param serializedValue  The JSSerializedValue whose byte length to return.
+ @result                 The number of bytes pointed to by the result of JSSerializedValueGetBytesPtr, or 0 if serializedValue carries transferred Array Buffers.
+ */
+JS_EXPORT size_t JSSerializedValueGetByteLength(JSSerializedValueRef serializedValue) API_AVAILABLE(macos(JSC_MAC_TBA), ios(JSC_IOS_TBA));
+
+/*!
+ @function
+ @abstract               Creates a serialized value from bytes obtained with JSSerializedValueGetBytesPtr.
+ @param bytes            A pointer to the serialized bytes. They are copied.
+ @param byteLength       The number of bytes pointed to by bytes.
+ @result                 A JSSerializedValue. Ownership follows the Create Rule. Malformed input is only detected when the value is deserialized, which then throws a DataCloneError.
+ */
+JS_EXPORT JSSerializedValueRef JSSerializedValueCreateWithBytes(const void* bytes, size_t byteLength) API_AVAILABLE(macos(JSC_MAC_TBA), ios(JSC_IOS_TBA));
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* JSSerializedValue_h */
@@ -8,6 +8,8 @@
 #ifndef __cplusplus
 #include <stdbool.h>
 #endif
+#include <stddef.h> /* for size_t */
+#include <stdint.h> /* for int32_t, uint64_t */
 
 /*!
 @enum JSType
@@ -19,6 +21,7 @@
 @constant     kJSTypeString     A primitive string value.
 @constant     kJSTypeObject     An object value (meaning that this JSValueRef is a JSObjectRef).
 @constant     kJSTypeSymbol     A primitive symbol value.
+@constant     kJSTypeBigInt     A primitive BigInt value.
 */
 typedef enum {
     kJSTypeUndefined,
@@ -27,7 +30,8 @@ typedef enum {
     kJSTypeNumber,
     kJSTypeString,
     kJSTypeObject,
-    kJSTypeSymbol API_AVAILABLE(macos(10.15), ios(13.0))
+    kJSTypeSymbol API_AVAILABLE(macos(10.15), ios(13.0)),
+    kJSTypeBigInt API_AVAILABLE(macos(JSC_MAC_TBA), ios(JSC_IOS_TBA))
 } JSType;
 
 /*!
@@ -70,6 +74,7 @@ extern "C" {
 @param ctx  The execution context to use.
 @param value    The JSValue whose type you want to obtain.
 @result         A value of type JSType that identifies value's type.
+@discussion     BigInt values, including small BigInts stored as immediates, return kJSTypeBigInt. That constant was added after the others, so a switch over the result written for earlier releases should be updated to handle it rather than let BigInts fall into a default case.
 */
 JS_EXPORT JSType JSValueGetType(JSContextRef ctx, JSValueRef value);
 
@@ -127,6 +132,15 @@ JS_EXPORT bool JSValueIsString(JSContextRef ctx, JSValueRef value);
 */
 JS_EXPORT bool JSValueIsSymbol(JSContextRef ctx, JSValueRef value) API_AVAILABLE(macos(10.15), ios(13.0));
 
+/*!
+@function
+@abstract       Tests whether a JavaScript value's type is the BigInt type.
+@param ctx      The execution context to use.
+@param value    The JSValue to test.
+@result         true if value's type is the BigInt type, otherwise false.
+*/
+JS_EXPORT bool JSValueIsBigInt(JSContextRef ctx, JSValueRef value) API_AVAILABLE(macos(JSC_MAC_TBA), ios(JSC_IOS_TBA));
+
 /*!
 @function
 @abstract       Tests whether a JavaScript value's type is the object type.
@@ -245,6 +259,27 @@ JS_EXPORT JSValueRef JSValueMakeBoolean(JSContextRef ctx, bool boolean);
 */
 JS_EXPORT JSValueRef JSValueMakeNumber(JSContextRef ctx, double number);
 
+/*!
+@function
+@abstract       Creates a JavaScript value of the number type from a 32-bit signed integer.
+ |-- 使用32位有符号整数创建number类型的JavaScript值。
+@param ctx  The execution context to use.
+@param number   The int32_t to assign to the newly created JSValue.
+@result         A JSValue of the number type, representing the value of number.
+@discussion     The value is created directly in the engine's int32 representation, without going through a double.
+*/
+JS_EXPORT JSValueRef JSValueMakeInt32(JSContextRef ctx, int32_t number) API_AVAILABLE(macos(JSC_MAC_TBA), ios(JSC_IOS_TBA));
+
+/*!
+@function
+@abstract       Creates a JavaScript value of the number type from a 32-bit unsigned integer.
+@param ctx  The execution context to use.
+@param number   The uint32_t to assign to the newly created JSValue.
+@result         A JSValue of the number type, representing the value of number.
+@discussion     Values up to INT32_MAX are created in the engine's int32 representation; larger values are stored as doubles.
+*/
+JS_EXPORT JSValueRef JSValueMakeUInt32(JSContextRef ctx, uint32_t number) API_AVAILABLE(macos(JSC_MAC_TBA), ios(JSC_IOS_TBA));
+
 /*!
 @function
 @abstract       Creates a JavaScript value of the string type.
@@ -264,6 +299,20 @@ JS_EXPORT JSValueRef JSValueMakeString(JSContextRef ctx, JSStringRef string);
  */
 JS_EXPORT JSValueRef JSValueMakeSymbol(JSContextRef ctx, JSStringRef description) API_AVAILABLE(macos(10.15), ios(13.0));
 
+/*!
+ @function
+ @abstract            Creates a JavaScript value of the BigInt type from an array of 64-bit limbs.
+ |-- 使用64位limb数组创建BigInt类型的JavaScript值。
+ @param ctx           The execution context to use.
+ @param negative      true if the BigInt is negative. Ignored if the magnitude is zero.
+ @param limbs         The magnitude of the BigInt as an array of unsigned 64-bit limbs, least significant limb first. Pass NULL if limbCount is 0.
+ @param limbCount     An integer count of the number of limbs in limbs. High-order zero limbs are allowed and are dropped.
+ @param exception     A pointer to a JSValueRef in which to store an exception, if any. Pass NULL if you do not care to store an exception.
+ @result              A JSValue of the BigInt type, or NULL if the value is larger than the maximum BigInt size and a RangeError is thrown.
+ @discussion          For example, the 128-bit value 2^64 + 5 is passed as limbs { 5, 1 }.
+ */
+JS_EXPORT JSValueRef JSValueMakeBigInt(JSContextRef ctx, bool negative, const uint64_t limbs[], size_t limbCount, JSValueRef* exception) API_AVAILABLE(macos(JSC_MAC_TBA), ios(JSC_IOS_TBA));
+
 /* Converting to and from JSON formatted strings */
 
 /*!
@@ -275,6 +324,22 @@ JS_EXPORT JSValueRef JSValueMakeSymbol(JSContextRef ctx, JSStringRef description
  */
 JS_EXPORT JSValueRef JSValueMakeFromJSONString(JSContextRef ctx, JSStringRef string) API_AVAILABLE(macos(10.7), ios(7.0));
 
+/*!
+ @function
+ @abstract       Creates a JavaScript value from a buffer of JSON formatted UTF-8 text.
+ |--  直接从UTF-8编码的JSON文本创建JavaScript值。
+ @param ctx      The execution context to use.
+ @param bytes    The UTF-8 bytes to parse. The buffer need not be null-terminated.
+ @param length   The number of bytes in bytes.
+ @param errorOffset A pointer to a size_t in which to store the byte offset at which parsing failed, if it did. Pass NULL if you do not care to know the offset.
+ @param exception A pointer to a JSValueRef in which to store a SyntaxError describing the failure, if any. Pass NULL if you do not care to store an exception.
+ @result         A JSValue containing the parsed value, or NULL if the input is invalid.
+ @discussion     The input is parsed in place; it is not widened to UTF-16 first. Structural characters and the ends of strings are located with vector instructions where available, and strings that are pure ASCII are created as 8-bit strings without re-encoding. Objects that share the same sequence of keys, as the elements of an array of records usually do, are created directly with a shared structure.
+
+ Accepts exactly the grammar of JSON.parse. Invalid UTF-8 is a syntax error.
+ */
+JS_EXPORT JSValueRef JSValueMakeFromJSONUTF8(JSContextRef ctx, const char* bytes, size_t length, size_t* errorOffset, JSValueRef* exception) API_AVAILABLE(macos(JSC_MAC_TBA), ios(JSC_IOS_TBA));
+
 /*!
  @function
  @abstract       Creates a JavaScript string containing the JSON serialized representation of a JS value.
@@ -286,6 +351,39 @@ JS_EXPORT JSValueRef JSValueMakeFromJSONString(JSContextRef ctx, JSStringRef str
  */
 JS_EXPORT JSStringRef JSValueCreateJSONString(JSContextRef ctx, JSValueRef value, unsigned indent, JSValueRef* exception) API_AVAILABLE(macos(10.7), ios(7.0));
 
+/*!
+ @typedef JSValueJSONWriteCallback
+ @abstract       The callback invoked with each chunk of output produced by JSValueWriteJSON.
+ @param bytes    A buffer of UTF-8 encoded JSON text. The buffer is only valid until the callback returns.
+ @param length   The number of bytes in bytes.
+ @param context  The context pointer passed to JSValueWriteJSON.
+ @result         true to continue serializing, or false to stop.
+ @discussion     If you named your function WriteJSON, you would declare it like this:
+
+ bool WriteJSON(const char* bytes, size_t length, void* context);
+
+ To write to a file descriptor, pass the descriptor through context and call write() in the callback.
+ */
+typedef bool
+(*JSValueJSONWriteCallback) (const char* bytes, size_t length, void* context);
+
+/*!
+ @function
+ @abstract       Serializes a JS value as JSON, writing UTF-8 output incrementally to a callback.
+ |--  将JS值序列化为JSON，并以UTF-8分块写入回调。
+ @param ctx      The execution context to use.
+ @param value    The value to serialize.
+ @param indent   The number of spaces to indent when nesting, with the same meaning as in JSValueCreateJSONString.
+ @param write    The JSValueJSONWriteCallback to invoke with each chunk of output.
+ @param context  A pointer to pass back to write.
+ @param exception A pointer to a JSValueRef in which to store an exception, if any. Pass NULL if you do not care to store an exception.
+ @result         true if the whole value was serialized, or false if an exception was thrown or write returned false.
+ @discussion     The output is identical, once transcoded, to the string JSValueCreateJSONString would return, but it is never built up in memory: the serializer encodes directly into a fixed-size UTF-8 buffer and hands it to write each time it fills. Memory use is bounded by that buffer and the depth of value, not by the size of the output. If value has no JSON representation, such as the undefined value, nothing is written.
+
+ Chunks already passed to write are not retracted if serialization later fails.
+ */
+JS_EXPORT bool JSValueWriteJSON(JSContextRef ctx, JSValueRef value, unsigned indent, JSValueJSONWriteCallback write, void* context, JSValueRef* exception) API_AVAILABLE(macos(JSC_MAC_TBA), ios(JSC_IOS_TBA));
+
 /* Converting to primitive values */
 
 /*!
@@ -307,6 +405,45 @@ JS_EXPORT bool JSValueToBoolean(JSContextRef ctx, JSValueRef value);
 */
 JS_EXPORT double JSValueToNumber(JSContextRef ctx, JSValueRef value, JSValueRef* exception);
 
+/*!
+@function
+@abstract       Converts a JavaScript value to a 32-bit signed integer and returns the result.
+ |-- 将JavaScript值转换为32位有符号整数。
+@param ctx  The execution context to use.
+@param value    The JSValue to convert.
+@param exception A pointer to a JSValueRef in which to store an exception, if any. Pass NULL if you do not care to store an exception.
+@result         The result of converting value with the JavaScript ToInt32 operation, or 0 if an exception is thrown.
+@discussion     If value is already stored as an int32, it is returned directly. Doubles are truncated and wrapped modulo 2^32 without a call into the generic conversion path; only non-number values go through ToNumber first, which may run JavaScript code.
+*/
+JS_EXPORT int32_t JSValueToInt32(JSContextRef ctx, JSValueRef value, JSValueRef* exception) API_AVAILABLE(macos(JSC_MAC_TBA), ios(JSC_IOS_TBA));
+
+/*!
+@function
+@abstract       Converts a JavaScript value to a 32-bit unsigned integer and returns the result.
+@param ctx  The execution context to use.
+@param value    The JSValue to convert.
+@param exception A pointer to a JSValueRef in which to store an exception, if any. Pass NULL if you do not care to store an exception.
+@result         The result of converting value with the JavaScript ToUint32 operation, or 0 if an exception is thrown.
+@discussion     Has the same fast paths as JSValueToInt32.
+*/
+JS_EXPORT uint32_t JSValueToUInt32(JSContextRef ctx, JSValueRef value, JSValueRef* exception) API_AVAILABLE(macos(JSC_MAC_TBA), ios(JSC_IOS_TBA));
+
+/*!
+@function
+@abstract       Returns a pointer to the limbs of a BigInt value.
+ |-- 返回BigInt值的limb数组指针，不经过十进制字符串转换。
+@param ctx      The execution context to use.
+@param value    The BigInt value whose limbs to return.
+@param immediateLimb A pointer to a uint64_t that receives the magnitude of value if the engine stores value as an immediate rather than as a heap BigInt. Must not be NULL.
+@param negative A pointer to a bool in which to store whether value is negative. Pass NULL if you do not care to know the sign.
+@param limbCount A pointer to a size_t in which to store the number of limbs. Must not be NULL. Zero has no limbs.
+@result         A pointer to the magnitude of value as unsigned 64-bit limbs, least significant limb first, with no high-order zero limbs; or NULL if value is not a BigInt or is zero.
+@discussion     On 64-bit architectures, BigInts whose value fits in an int32 may be stored as immediates inside the JSValueRef, with no digits in memory. For those, the magnitude is written to immediateLimb, *limbCount is set to 1, and the result is immediateLimb, so the pointer stays valid for as long as the caller's buffer does. For every other BigInt on 64-bit architectures, the pointer addresses the BigInt's own digits, so nothing is copied and immediateLimb is not written. On 32-bit architectures, the digits are packed into 64-bit limbs the first time this function is called, and the packed copy is kept with the BigInt.
+
+ BigInts are immutable, so the limbs never change, but the pointer is temporary and is not guaranteed to remain valid across JavaScriptCore API calls, in the same way as JSObjectGetTypedArrayBytesPtr.
+*/
+JS_EXPORT const uint64_t* JSValueGetBigIntLimbs(JSContextRef ctx, JSValueRef value, uint64_t* immediateLimb, bool* negative, size_t* limbCount) API_AVAILABLE(macos(JSC_MAC_TBA), ios(JSC_IOS_TBA));
+
 /*!
 @function
 @abstract       Converts a JavaScript value to string and copies the result into a JavaScript string.
@@ -317,6 +454,45 @@ JS_EXPORT double JSValueToNumber(JSContextRef ctx, JSValueRef value, JSValueRef*
 */
 JS_EXPORT JSStringRef JSValueToStringCopy(JSContextRef ctx, JSValueRef value, JSValueRef* exception);
 
+/*!
+@function
+@abstract       Converts a JavaScript value to string and writes the result into a buffer as a null-terminated UTF8 string.
+ |-- 将JavaScript值转换为字符串，并以UTF8形式直接写入缓冲区。
+@param ctx  The execution context to use.
+@param value    The JSValue to convert.
+@param buffer   The destination byte buffer. On return, buffer contains as much of the null-terminated UTF8 result as fits in bufferSize bytes, cut at a character boundary. Pass NULL if bufferSize is 0.
+@param bufferSize The size of buffer in bytes.
+@param length   A pointer to a size_t in which to store the exact length in bytes of the UTF8 result, not counting the null-terminator, even if it did not fit in buffer. If it is greater than or equal to bufferSize, call again with a buffer of at least *length + 1 bytes. Pass NULL if you do not care to know the length. Left unchanged if the function returns false.
+@param exception A pointer to a JSValueRef in which to store an exception, if any. Pass NULL if you do not care to store an exception.
+@result         true if value was converted, or false if an exception is thrown. If the function returns false and bufferSize is not 0, buffer contains an empty string. A value that converts to the empty string returns true with a length of 0.
+@discussion     This replaces the sequence JSValueToStringCopy, JSStringGetMaximumUTF8CStringSize, JSStringGetUTF8CString and JSStringRelease with one pass and no intermediate JSString. Numbers, booleans, null and undefined are formatted straight into buffer; strings are transcoded straight from their 8-bit or 16-bit storage. Unpaired surrogates are written as U+FFFD.
+*/
+JS_EXPORT bool JSValueToUTF8CString(JSContextRef ctx, JSValueRef value, char* buffer, size_t bufferSize, size_t* length, JSValueRef* exception) API_AVAILABLE(macos(JSC_MAC_TBA), ios(JSC_IOS_TBA));
+
+/*!
+@typedef JSUTF8Allocator
+@abstract       A function used to allocate the buffer returned by JSValueCopyUTF8CString.
+@param size     The number of bytes to allocate.
+@param allocatorContext The context pointer passed to JSValueCopyUTF8CString.
+@result         A pointer to at least size bytes, or NULL if allocation failed.
+@discussion     An arena allocator can be used here, so that the strings of a whole batch are freed at once.
+*/
+typedef void*
+(*JSUTF8Allocator) (size_t size, void* allocatorContext);
+
+/*!
+@function
+@abstract       Converts a JavaScript value to string and copies the result into a newly allocated null-terminated UTF8 string.
+@param ctx  The execution context to use.
+@param value    The JSValue to convert.
+@param allocate The JSUTF8Allocator used to allocate the result. It is called exactly once, with the exact size of the result including the null-terminator, unless an exception is thrown first.
+@param allocatorContext A pointer to pass back to allocate.
+@param length   A pointer to a size_t in which to store the length of the result in bytes, not counting the null-terminator. Pass NULL if you do not care to know the length.
+@param exception A pointer to a JSValueRef in which to store an exception, if any. Pass NULL if you do not care to store an exception.
+@result         The buffer returned by allocate, containing the null-terminated UTF8 result, or NULL if an exception is thrown or allocate returns NULL. The caller owns the buffer.
+*/
+JS_EXPORT char* JSValueCopyUTF8CString(JSContextRef ctx, JSValueRef value, JSUTF8Allocator allocate, void* allocatorContext, size_t* length, JSValueRef* exception) API_AVAILABLE(macos(JSC_MAC_TBA), ios(JSC_IOS_TBA));
+
 /*!
 @function
 @abstract Converts a JavaScript value to object and returns the resulting object.
@@ -349,6 +525,49 @@ JS_EXPORT void JSValueProtect(JSContextRef ctx, JSValueRef value);
 */
 JS_EXPORT void JSValueUnprotect(JSContextRef ctx, JSValueRef value);
 
+/*!
+@function
+@abstract       Creates a handle that protects a JavaScript value from garbage collection.
+ |-- 创建一个保护JavaScript值不被垃圾回收的句柄。
+@param ctx      The execution context to use.
+@param value    The JSValue to protect. Pass NULL to create an empty handle.
+@result         A JSPersistentValue holding value. It must be destroyed with JSPersistentValueDestroy.
+@discussion     Use a persistent value instead of JSValueProtect when you hold many values, or protect and unprotect them often. Handles are carved out of fixed-size blocks owned by the context group, and each thread takes free handles from its own block, so creating a handle, and destroying it on the thread that created it, is a constant-time free-list operation with no hashing and no atomic operations. The garbage collector scans the blocks linearly as roots.
+
+A handle destroyed on another thread cannot go on the creating thread's free list directly. It is pushed onto a separate list of the owning block with a single atomic compare-and-swap, and the creating thread moves that list onto its own free list the next time its free list runs empty. Cross-thread destruction is therefore lock-free but not free of contention.
+
+Unlike JSValueProtect, a persistent value is not counted: each handle is one independent root.
+*/
+JS_EXPORT JSPersistentValueRef JSPersistentValueCreate(JSContextRef ctx, JSValueRef value) API_AVAILABLE(macos(JSC_MAC_TBA), ios(JSC_IOS_TBA));
+
+/*!
+@function
+@abstract       Returns the value held by a persistent value handle.
+@param ctx      The execution context to use. It must belong to the same context group as the handle.
+@param handle   The JSPersistentValue to read.
+@result         The JSValue held by handle, or NULL if handle is empty.
+@discussion     This function takes the API lock of ctx's context group, like JSPersistentValueSet and JSPersistentValueDestroy. It must not run concurrently with JSPersistentValueSet or JSPersistentValueDestroy on the same handle. The result stays alive while handle holds it, or while it is kept on the stack (or protected), as with any other JSValueRef.
+*/
+JS_EXPORT JSValueRef JSPersistentValueGet(JSContextRef ctx, JSPersistentValueRef handle) API_AVAILABLE(macos(JSC_MAC_TBA), ios(JSC_IOS_TBA));
+
+/*!
+@function
+@abstract       Replaces the value held by a persistent value handle.
+@param ctx      The execution context to use.
+@param handle   The JSPersistentValue to update.
+@param value    The JSValue to protect instead. Pass NULL to empty the handle.
+*/
+JS_EXPORT void JSPersistentValueSet(JSContextRef ctx, JSPersistentValueRef handle, JSValueRef value) API_AVAILABLE(macos(JSC_MAC_TBA), ios(JSC_IOS_TBA));
+
+/*!
+@function
+@abstract       Destroys a persistent value handle, making its value eligible for garbage collection.
+@param ctx      The execution context to use. It must belong to the same context group as the handle.
+@param handle   The JSPersistentValue to destroy. It must not be used afterwards.
+@discussion     A handle may be destroyed on a different thread from the one that created it. When the context group is destroyed, any remaining handles are destroyed with it.
+*/
+JS_EXPORT void JSPersistentValueDestroy(JSContextRef ctx, JSPersistentValueRef handle) API_AVAILABLE(macos(JSC_MAC_TBA), ios(JSC_IOS_TBA));
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,273 @@
+#ifndef JSValueRefInlines_h
+#define JSValueRefInlines_h
+
+#include <JavaScriptCore/JSValueRef.h>
+
+#ifndef __cplusplus
+#include <stdbool.h>
+#endif
+#include <stdint.h> /* for int32_t, uint64_t */
+#include <string.h> /* for memcpy */
+
+/*
+ This header is opt-in: it is not included by JavaScript.h or JavaScriptCore.h.
+
+ It exposes the engine's in-register encoding of JSValueRef, so that immediate
+ type checks and number extraction compile to a few instructions instead of an
+ exported call. Every function here has the same signature and result as the
+ exported function of the same name without the Inline suffix, and falls back
+ to it for values whose answer is not encoded in the JSValueRef itself.
+
+ |-- 这个头文件需要显式引入，JavaScript.h和JavaScriptCore.h不会包含它。它公开了JSValueRef的内部编码，
+ 使立即数类型判断和数字提取可以内联成几条指令，而不必调用导出函数。
+
+ The encoding may change between releases. Check once, at startup, that
+ JSValueGetEncodingVersion() returns JSC_VALUE_ENCODING_VERSION before using
+ any of these functions, and fall back to the exported functions if it does not.
+*/
+
+/*!
+@define JSC_VALUE_ENCODING_VERSION
+@abstract The version of the value encoding this header was written against.
+*/
+#define JSC_VALUE_ENCODING_VERSION 1
+
+/*!
+@define JSC_VALUE_ENCODING_INLINE
+@abstract 1 if JSValueRefs are encoded values on this architecture and the inline fast paths are used, otherwise 0.
+@discussion On 32-bit architectures, the C API boxes non-cell values, so every function in this header simply calls its exported counterpart.
+*/
+#if defined(__LP64__) || defined(_WIN64)
+#define JSC_VALUE_ENCODING_INLINE 1
+#else
+#define JSC_VALUE_ENCODING_INLINE 0
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+@function
+@abstract       Returns the version of the value encoding used by the JavaScriptCore library loaded at runtime.
+@result         The library's encoding version. The inline functions in this header are only correct if it equals JSC_VALUE_ENCODING_VERSION.
+*/
+JS_EXPORT unsigned JSValueGetEncodingVersion(void) API_AVAILABLE(macos(JSC_MAC_TBA), ios(JSC_IOS_TBA));
+
+#if JSC_VALUE_ENCODING_INLINE
+/* Encoding version 1, for 64-bit architectures:
+   - A pointer with none of the bits in kJSValueEncodingNotCellMask set is a cell (string, symbol, heap BigInt or object).
+   - A value whose bits in kJSValueEncodingBigInt32Mask equal kJSValueEncodingBigInt32Tag is a BigInt that fits in an int32, held in bits 16 to 47.
+   - A value with all of kJSValueEncodingNumberTag set is an int32, held in the low 32 bits.
+   - Any other value with some of kJSValueEncodingNumberTag set is a double, offset by kJSValueEncodingDoubleOffset.
+   - false, true, undefined and null are the small constants below.
+*/
+static const uint64_t kJSValueEncodingNumberTag    = 0xfffe000000000000ull;
+static const uint64_t kJSValueEncodingDoubleOffset = 1ull << 49;
+static const uint64_t kJSValueEncodingNotCellMask  = 0xfffe000000000002ull;
+static const uint64_t kJSValueEncodingFalse        = 0x6;
+static const uint64_t kJSValueEncodingTrue         = 0x7;
+static const uint64_t kJSValueEncodingNull         = 0x2;
+static const uint64_t kJSValueEncodingUndefined    = 0xa;
+static const uint64_t kJSValueEncodingBigInt32Tag  = 0x12;
+static const uint64_t kJSValueEncodingBigInt32Mask = 0xfffe000000000012ull;
+
+static inline uint64_t JSValueEncodingGetBits(JSValueRef value)
+{
+    return (uint64_t)(uintptr_t)value;
+}
+#endif /* JSC_VALUE_ENCODING_INLINE */
+
+/*!
+@function
+@abstract       Inline version of JSValueIsUndefined.
+*/
+static inline bool JSValueIsUndefinedInline(JSContextRef ctx, JSValueRef value)
+{
+#if JSC_VALUE_ENCODING_INLINE
+    (void)ctx;
+    return JSValueEncodingGetBits(value) == kJSValueEncodingUndefined;
+#else
+    return JSValueIsUndefined(ctx, value);
+#endif
+}
+
+/*!
+@function
+@abstract       Inline version of JSValueIsNull.
+*/
+static inline bool JSValueIsNullInline(JSContextRef ctx, JSValueRef value)
+{
+#if JSC_VALUE_ENCODING_INLINE
+    uint64_t bits = JSValueEncodingGetBits(value);
+    (void)ctx;
+    /* The C API treats a NULL JSValueRef as null. */
+    return bits == kJSValueEncodingNull || !bits;
+#else
+    return JSValueIsNull(ctx, value);
+#endif
+}
+
+/*!
+@function
+@abstract       Inline version of JSValueIsBoolean.
+*/
+static inline bool JSValueIsBooleanInline(JSContextRef ctx, JSValueRef value)
+{
+#if JSC_VALUE_ENCODING_INLINE
+    (void)ctx;
+    return (JSValueEncodingGetBits(value) & ~1ull) == kJSValueEncodingFalse;
+#else
+    return JSValueIsBoolean(ctx, value);
+#endif
+}
+
+/*!
+@function
+@abstract       Inline version of JSValueIsNumber.
+*/
+static inline bool JSValueIsNumberInline(JSContextRef ctx, JSValueRef value)
+{
+#if JSC_VALUE_ENCODING_INLINE
+    (void)ctx;
+    return (JSValueEncodingGetBits(value) & kJSValueEncodingNumberTag) != 0;
+#else
+    return JSValueIsNumber(ctx, value);
+#endif
+}
+
+/*!
+@function
+@abstract       Tests whether a JavaScript value is a number stored as an int32.
+@param ctx      The execution context to use.
+@param value    The JSValue to test.
+@result         true if value is a number that the engine currently represents as an int32, otherwise false.
+@discussion     A number with an integral value in the int32 range may still be stored as a double, for example if it was produced by floating point arithmetic. Use JSValueIsNumberInline and JSValueGetNumberInline if you need to handle every number.
+*/
+static inline bool JSValueIsInt32Inline(JSContextRef ctx, JSValueRef value)
+{
+#if JSC_VALUE_ENCODING_INLINE
+    (void)ctx;
+    return (JSValueEncodingGetBits(value) & kJSValueEncodingNumberTag) == kJSValueEncodingNumberTag;
+#else
+    double number;
+    if (!JSValueIsNumber(ctx, value))
+        return false;
+    number = JSValueToNumber(ctx, value, NULL);
+    return number >= INT32_MIN && number <= INT32_MAX && number == (double)(int32_t)number && !(number == 0 && 1 / number < 0);
+#endif
+}
+
+/*!
+@function
+@abstract       Returns the value of a number stored as an int32.
+@param ctx      The execution context to use.
+@param value    A JSValue for which JSValueIsInt32Inline returns true. The result is undefined for any other value.
+@result         The int32 value of value.
+*/
+static inline int32_t JSValueGetInt32Inline(JSContextRef ctx, JSValueRef value)
+{
+#if JSC_VALUE_ENCODING_INLINE
+    (void)ctx;
+    return (int32_t)JSValueEncodingGetBits(value);
+#else
+    return (int32_t)JSValueToNumber(ctx, value, NULL);
+#endif
+}
+
+/*!
+@function
+@abstract       Inline version of JSValueMakeInt32.
+*/
+static inline JSValueRef JSValueMakeInt32Inline(JSContextRef ctx, int32_t number)
+{
+#if JSC_VALUE_ENCODING_INLINE
+    (void)ctx;
+    return (JSValueRef)(uintptr_t)(kJSValueEncodingNumberTag | (uint32_t)number);
+#else
+    return JSValueMakeInt32(ctx, number);
+#endif
+}
+
+/*!
+@function
+@abstract       Returns the value of a number.
+@param ctx      The execution context to use.
+@param value    A JSValue for which JSValueIsNumberInline returns true. The result is undefined for any other value.
+@result         The numeric value of value. Unlike JSValueToNumber, no conversion is performed.
+*/
+static inline double JSValueGetNumberInline(JSContextRef ctx, JSValueRef value)
+{
+#if JSC_VALUE_ENCODING_INLINE
+    uint64_t bits = JSValueEncodingGetBits(value);
+    double number;
+    (void)ctx;
+    if ((bits & kJSValueEncodingNumberTag) == kJSValueEncodingNumberTag)
+        return (double)(int32_t)bits;
+    bits -= kJSValueEncodingDoubleOffset;
+    memcpy(&number, &bits, sizeof(number));
+    return number;
+#else
+    return JSValueToNumber(ctx, value, NULL);
+#endif
+}
+
+/*!
+@function
+@abstract       Inline version of JSValueToBoolean.
+@discussion     Numbers, booleans, undefined, null and immediate BigInts are converted inline. Any other value is converted by calling JSValueToBoolean.
+*/
+static inline bool JSValueToBooleanInline(JSContextRef ctx, JSValueRef value)
+{
+#if JSC_VALUE_ENCODING_INLINE
+    uint64_t bits = JSValueEncodingGetBits(value);
+    if (!(bits & kJSValueEncodingNotCellMask))
+        return JSValueToBoolean(ctx, value);
+    if (bits & kJSValueEncodingNumberTag) {
+        double number = JSValueGetNumberInline(ctx, value);
+        return number == number && number != 0;
+    }
+    if ((bits & kJSValueEncodingBigInt32Mask) == kJSValueEncodingBigInt32Tag)
+        return (int32_t)(bits >> 16) != 0;
+    if (bits == kJSValueEncodingTrue)
+        return true;
+    if (bits == kJSValueEncodingFalse || bits == kJSValueEncodingNull || bits == kJSValueEncodingUndefined)
+        return false;
+    return JSValueToBoolean(ctx, value);
+#else
+    return JSValueToBoolean(ctx, value);
+#endif
+}
+
+/*!
+@function
+@abstract       Inline version of JSValueGetType.
+@discussion     The type of numbers, booleans, undefined, null and immediate BigInts is computed inline. The type of any other value is obtained by calling JSValueGetType.
+*/
+static inline JSType JSValueGetTypeInline(JSContextRef ctx, JSValueRef value)
+{
+#if JSC_VALUE_ENCODING_INLINE
+    uint64_t bits = JSValueEncodingGetBits(value);
+    if (!(bits & kJSValueEncodingNotCellMask))
+        return JSValueGetType(ctx, value);
+    if (bits & kJSValueEncodingNumberTag)
+        return kJSTypeNumber;
+    if ((bits & ~1ull) == kJSValueEncodingFalse)
+        return kJSTypeBoolean;
+    if (bits == kJSValueEncodingNull)
+        return kJSTypeNull;
+    if ((bits & kJSValueEncodingBigInt32Mask) == kJSValueEncodingBigInt32Tag)
+        return kJSTypeBigInt;
+    if (bits == kJSValueEncodingUndefined)
+        return kJSTypeUndefined;
+    return JSValueGetType(ctx, value);
+#else
+    return JSValueGetType(ctx, value);
+#endif
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* JSValueRefInlines_h */
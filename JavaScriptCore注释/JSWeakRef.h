@@ -0,0 +1,81 @@
+#ifndef JSWeakRef_h
+#define JSWeakRef_h
+
+#include <JavaScriptCore/JSBase.h>
+#include <JavaScriptCore/WebKitAvailability.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+@typedef JSWeakFinalizeCallback
+@abstract The callback invoked after the target of a weak reference has been garbage collected.
+@param weak The JSWeak whose target was collected. JSWeakGetObject returns NULL for it from now on.
+@param context The context pointer passed to JSWeakCreateWithFinalizer.
+@discussion If you named your function WeakFinalize, you would declare it like this:
+
+void WeakFinalize(JSWeakRef weak, void* context);
+
+Like a JavaScript FinalizationRegistry callback, it does not run during garbage collection. It runs when the outermost API lock of the context group is next released after the collection that cleared weak: on the releasing thread, just before the lock is dropped, once the outermost JavaScriptCore API call (for example JSEvaluateScript) is about to return. Collections started from the group's run loop (see JSContextGroupCreate) take the API lock themselves, so their callbacks run when that run loop task returns. It may call any JavaScriptCore API, for example to drop a cache entry keyed by weak; the API lock is held for the duration of the callback.
+ |-- 在垃圾回收清除了weak之后，当上下文组最外层的API锁下一次被释放时，在释放锁的线程上、真正释放锁之前执行。
+*/
+typedef void
+(*JSWeakFinalizeCallback) (JSWeakRef weak, void* context);
+
+/*!
+@function
+@abstract Creates a weak reference to a JavaScript object.
+ |-- 创建一个对JavaScript对象的弱引用。
+@param group The context group that object belongs to.
+@param object The JSObject to refer to.
+@result A JSWeak referring to object. Ownership follows the Create Rule.
+@discussion A weak reference does not keep object alive. Unlike JSValueProtect, creating and releasing one does not touch the group's table of protected values, and the garbage collector only visits the weak reference after marking, to clear it if object died.
+*/
+JS_EXPORT JSWeakRef JSWeakCreate(JSContextGroupRef group, JSObjectRef object) API_AVAILABLE(macos(JSC_MAC_TBA), ios(JSC_IOS_TBA));
+
+/*!
+@function
+@abstract Creates a weak reference to a JavaScript object, with a callback to invoke once the object has been collected.
+@param group The context group that object belongs to.
+@param object The JSObject to refer to.
+@param finalize The JSWeakFinalizeCallback to invoke after object has been collected.
+@param context A pointer to pass back to finalize.
+@result A JSWeak referring to object. Ownership follows the Create Rule.
+@discussion finalize is not invoked if the JSWeak is released before object is collected, nor if the context group is destroyed first.
+*/
+JS_EXPORT JSWeakRef JSWeakCreateWithFinalizer(JSContextGroupRef group, JSObjectRef object, JSWeakFinalizeCallback finalize, void* context) API_AVAILABLE(macos(JSC_MAC_TBA), ios(JSC_IOS_TBA));
+
+/*!
+@function
+@abstract Retains a weak reference.
+@param weak The JSWeak to retain.
+@result A JSWeak that is the same as weak.
+*/
+JS_EXPORT JSWeakRef JSWeakRetain(JSWeakRef weak) API_AVAILABLE(macos(JSC_MAC_TBA), ios(JSC_IOS_TBA));
+
+/*!
+@function
+@abstract Releases a weak reference.
+@param weak The JSWeak to release.
+*/
+JS_EXPORT void JSWeakRelease(JSWeakRef weak) API_AVAILABLE(macos(JSC_MAC_TBA), ios(JSC_IOS_TBA));
+
+/*!
+@function
+@abstract Gets the object a weak reference refers to.
+ |-- 获取弱引用指向的对象。
+@param ctx The execution context to use. It must belong to the context group the weak reference was created in.
+@param weak The JSWeak whose target you want to get.
+@result The JSObject weak refers to, or NULL if it has been collected.
+@discussion This function takes the API lock of ctx's context group, so the collector cannot clear weak while it runs. If the result is not NULL, it is reachable from the stack when this function returns and stays alive for as long as it is kept on the stack (or protected), as with any other JSObjectRef, even if the collector clears weak in the meantime.
+
+Destroying the context group clears every weak reference created in it, without invoking finalizers. A JSWeak that outlives its group may still be retained and released, but no context of that group exists any more; if ctx belongs to a different context group, this function returns NULL.
+*/
+JS_EXPORT JSObjectRef JSWeakGetObject(JSContextRef ctx, JSWeakRef weak) API_AVAILABLE(macos(JSC_MAC_TBA), ios(JSC_IOS_TBA));
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* JSWeakRef_h */
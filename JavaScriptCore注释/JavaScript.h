@@ -2,10 +2,14 @@
 #define JavaScript_h
 
 #include <JavaScriptCore/JSBase.h>
+#include <JavaScriptCore/JSCollection.h>
 #include <JavaScriptCore/JSContextRef.h>
 #include <JavaScriptCore/JSStringRef.h>
 #include <JavaScriptCore/JSObjectRef.h>
+#include <JavaScriptCore/JSRegExp.h>
+#include <JavaScriptCore/JSSerializedValue.h>
 #include <JavaScriptCore/JSTypedArray.h>
 #include <JavaScriptCore/JSValueRef.h>
+#include <JavaScriptCore/JSWeakRef.h>
 
 #endif /* JavaScript_h */
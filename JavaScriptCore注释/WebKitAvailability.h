@@ -53,5 +53,16 @@
 #define API_AVAILABLE(...)
 #endif
 
+/* Placeholder versions for API that has not shipped in an SDK yet. Header
+   postprocessing replaces these with the real version numbers at release time.
+*/
+#ifndef JSC_MAC_TBA
+#define JSC_MAC_TBA 0
+#endif
+
+#ifndef JSC_IOS_TBA
+#define JSC_IOS_TBA 0
+#endif
+
 #endif /* __WebKitAvailability__ */
 